@@ -248,6 +248,19 @@ public class Injections {
         getEventTracker().afterWrite();
     }
 
+    /**
+     * Called from the instrumented code before each shared memory access in the stress mode with noise injection.
+     * Unlike the other injections, it is called outside the model checking, so the noise injector may be absent.
+     */
+    public static void beforeSharedMemoryAccess(int location) {
+        Thread t = Thread.currentThread();
+        if (!(t instanceof TestThread)) return;
+        NoiseInjector noiseInjector = ((TestThread) t).noiseInjector;
+        if (noiseInjector != null) {
+            noiseInjector.beforeSharedMemoryAccess(location);
+        }
+    }
+
     /**
      * Called from the instrumented code before any method call.
      *
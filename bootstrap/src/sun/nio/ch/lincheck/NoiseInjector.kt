@@ -0,0 +1,20 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2024 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+package sun.nio.ch.lincheck
+
+/**
+ * Methods of this interface are called from the instrumented tested code
+ * in the stress mode with noise injection.
+ * See [Injections.beforeSharedMemoryAccess] for the documentation.
+ */
+interface NoiseInjector {
+    fun beforeSharedMemoryAccess(location: Int)
+}
@@ -32,6 +32,13 @@ class TestThread(
     @JvmField
     var eventTracker: EventTracker? = null
 
+    /**
+     * The [NoiseInjector] for perturbing the thread execution in the stress mode;
+     * `null` if the noise injection is disabled.
+     */
+    @JvmField
+    var noiseInjector: NoiseInjector? = null
+
     /**
      * The currently suspended continuation, if present.
      * It's stored here to provide a handle for resumption during testing.
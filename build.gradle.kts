@@ -14,6 +14,8 @@ apply(plugin = "kotlinx-atomicfu")
 plugins {
     java
     kotlin("multiplatform")
+    kotlin("plugin.allopen")
+    id("org.jetbrains.kotlinx.benchmark")
     id("maven-publish")
     id("kotlinx.team.infra") version "0.4.0-dev-80"
 }
@@ -33,6 +35,12 @@ kotlin {
         val test by compilations.getting {
             kotlinOptions.jvmTarget = "11"
         }
+
+        // JMH microbenchmarks of the framework internals, see the `benchmark` block below.
+        val benchmark by compilations.creating {
+            kotlinOptions.jvmTarget = "11"
+            associateWith(main)
+        }
     }
 
     sourceSets {
@@ -58,6 +66,8 @@ kotlin {
 
         val jvmTest by getting {
             kotlin.srcDir("src/jvm/test")
+            // The buggy implementations shared with the time-to-bug benchmark.
+            kotlin.srcDir("src/jvm/corpus")
 
             val junitVersion: String by project
             val jctoolsVersion: String by project
@@ -69,6 +79,37 @@ kotlin {
                 implementation("io.mockk:mockk:${mockkVersion}")
             }
         }
+
+        val jvmBenchmark by getting {
+            kotlin.srcDir("src/jvm/benchmark")
+            kotlin.srcDir("src/jvm/corpus")
+
+            val benchmarkVersion: String by project
+            dependencies {
+                implementation(project(":bootstrap"))
+                implementation("org.jetbrains.kotlinx:kotlinx-benchmark-runtime:$benchmarkVersion")
+            }
+        }
+    }
+}
+
+// JMH requires the benchmark state classes to be open.
+allOpen {
+    annotation("org.openjdk.jmh.annotations.State")
+}
+
+// All the benchmarks are run with `./gradlew benchmark`.
+benchmark {
+    configurations {
+        named("main") {
+            warmups = 3
+            iterations = 5
+            iterationTime = 1
+            iterationTimeUnit = "s"
+        }
+    }
+    targets {
+        register("jvmBenchmark")
     }
 }
 
@@ -170,6 +211,16 @@ tasks {
         dependsOn(jvmTestIsolated)
     }
 
+    register<JavaExec>("timeToBugBenchmark") {
+        group = "benchmark"
+        description = "Measures how fast the testing strategies find the bugs of a corpus of buggy implementations."
+        val benchmarkCompilation = kotlin.jvm().compilations["benchmark"]
+        classpath = files(benchmarkCompilation.output.allOutputs, benchmarkCompilation.runtimeDependencyFiles ?: files())
+        mainClass.set("org.jetbrains.kotlinx.lincheck_benchmark.timetobug.TimeToBugBenchmark")
+        args("$buildDir/reports/time-to-bug.csv")
+        maxHeapSize = "6g"
+    }
+
     withType<Jar> {
         dependsOn(bootstrapJar)
         manifest {
@@ -1,8 +1,11 @@
 pluginManagement {
     val kotlinVersion: String by settings
+    val benchmarkVersion: String by settings
     plugins {
         java
         kotlin("multiplatform") version kotlinVersion
+        kotlin("plugin.allopen") version kotlinVersion
+        id("org.jetbrains.kotlinx.benchmark") version benchmarkVersion
     }
 
     repositories {
@@ -0,0 +1,93 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.runner.*
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.transformation.*
+import java.util.concurrent.*
+
+/**
+ * The data structure under test in the benchmarks:
+ * a lock-free queue with enough shared memory accesses to make the interleavings non-trivial.
+ */
+class BenchmarkQueue {
+    private val queue = ConcurrentLinkedQueue<Int>()
+
+    @Operation
+    fun offer(x: Int) = queue.offer(x)
+
+    @Operation
+    fun poll(): Int? = queue.poll()
+}
+
+/**
+ * A typical scenario of the default size: three threads with two operations each.
+ */
+internal fun benchmarkScenario(): ExecutionScenario = scenario {
+    initial {
+        actor(BenchmarkQueue::offer, 1)
+    }
+    parallel {
+        thread {
+            actor(BenchmarkQueue::offer, 2)
+            actor(BenchmarkQueue::poll)
+        }
+        thread {
+            actor(BenchmarkQueue::offer, 3)
+            actor(BenchmarkQueue::poll)
+        }
+        thread {
+            actor(BenchmarkQueue::poll)
+            actor(BenchmarkQueue::offer, 4)
+        }
+    }
+    post {
+        actor(BenchmarkQueue::poll)
+    }
+}
+
+/**
+ * A strategy which only provides the scenario to a runner driven by the benchmark itself.
+ */
+internal class RunnerOnlyStrategy(scenario: ExecutionScenario) : Strategy(scenario) {
+    override fun run(): LincheckFailure? = throw UnsupportedOperationException()
+}
+
+internal fun createRunner(scenario: ExecutionScenario, useClocks: UseClocks) = ParallelThreadsRunner(
+    strategy = RunnerOnlyStrategy(scenario),
+    testClass = BenchmarkQueue::class.java,
+    validationFunction = null,
+    stateRepresentationFunction = null,
+    timeoutMs = CTestConfiguration.DEFAULT_TIMEOUT_MS,
+    useClocks = useClocks
+)
+
+/**
+ * Collects up to [count] distinct results of the [scenario] executions, which are produced
+ * as in the stress mode, so that the verifier benchmarks check realistic results.
+ */
+internal fun collectResults(scenario: ExecutionScenario, count: Int): List<ExecutionResult> {
+    val results = LinkedHashSet<ExecutionResult>()
+    withLincheckJavaAgent(InstrumentationMode.STRESS) {
+        createRunner(scenario, UseClocks.ALWAYS).use { runner ->
+            for (invocation in 0 until count * 1000) {
+                val ir = runner.run()
+                check(ir is CompletedInvocationResult) { "The benchmark scenario has failed: $ir" }
+                results += ir.results
+                if (results.size == count) break
+            }
+        }
+    }
+    return results.toList()
+}
@@ -0,0 +1,206 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.openjdk.jmh.annotations.*
+import sun.nio.ch.lincheck.*
+import java.util.*
+import java.util.concurrent.*
+
+/**
+ * Measures the overhead of the [Injections] calls inserted into the instrumented code.
+ *
+ * The calls from a regular thread correspond to the instrumented code executed outside of the testing,
+ * e.g., by the verifier; the calls from a [TestThread] are performed in batches,
+ * so that the cost of handing a batch to the test thread is amortized.
+ * The calls delegated to the [EventTracker] in the model checking mode are measured
+ * with a no-op tracker, so that only the cost of the dispatch is taken into account.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+class InjectionsBenchmark {
+    private val tasks = SynchronousQueue<Runnable>()
+    private val completions = SynchronousQueue<Any>()
+    private lateinit var testThread: TestThread
+
+    // Prevents the elimination of the calls executed in the test thread.
+    @Volatile
+    private var sink = 0
+
+    @Setup
+    fun setup() {
+        testThread = TestThread("InjectionsBenchmark", 0) {
+            try {
+                while (true) {
+                    val task = tasks.take()
+                    task.run()
+                    completions.put(task)
+                }
+            } catch (e: InterruptedException) {
+                // the benchmark is finished
+            }
+        }.apply {
+            isDaemon = true
+            noiseInjector = NoOpNoiseInjector
+            eventTracker = NoOpEventTracker
+            start()
+        }
+    }
+
+    @TearDown
+    fun tearDown() {
+        testThread.interrupt()
+    }
+
+    @Benchmark
+    fun inTestingCodeOutsideTestThread(): Boolean = Injections.inTestingCode()
+
+    @Benchmark
+    fun ignoredSectionOutsideTestThread() {
+        if (Injections.enterIgnoredSection()) Injections.leaveIgnoredSection()
+    }
+
+    @Benchmark
+    fun beforeSharedMemoryAccessOutsideTestThread() {
+        Injections.beforeSharedMemoryAccess(LOCATION)
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun inTestingCode() = inTestThread {
+        testThread.inTestingCode = true
+        var count = 0
+        repeat(BATCH_SIZE) { if (Injections.inTestingCode()) count++ }
+        testThread.inTestingCode = false
+        sink = count
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun ignoredSection() = inTestThread {
+        repeat(BATCH_SIZE) {
+            if (Injections.enterIgnoredSection()) Injections.leaveIgnoredSection()
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun beforeSharedMemoryAccess() = inTestThread {
+        repeat(BATCH_SIZE) { Injections.beforeSharedMemoryAccess(LOCATION + it) }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun readField() = inTestThread {
+        repeat(BATCH_SIZE) {
+            Injections.beforeReadField(this, CLASS_NAME, FIELD_NAME, LOCATION)
+            Injections.afterRead(it)
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun writeField() = inTestThread {
+        repeat(BATCH_SIZE) {
+            Injections.beforeWriteField(this, CLASS_NAME, FIELD_NAME, it, LOCATION)
+            Injections.afterWrite()
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun lockAndUnlock() = inTestThread {
+        repeat(BATCH_SIZE) {
+            Injections.beforeLock(LOCATION)
+            Injections.lock(this)
+            Injections.unlock(this, LOCATION)
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun methodCall() = inTestThread {
+        val params = arrayOf<Any?>(LOCATION)
+        repeat(BATCH_SIZE) {
+            Injections.beforeMethodCall(this, CLASS_NAME, METHOD_NAME, LOCATION, params)
+            Injections.onMethodCallFinishedSuccessfully(it)
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(BATCH_SIZE)
+    fun newObjectCreation() = inTestThread {
+        repeat(BATCH_SIZE) {
+            Injections.beforeNewObjectCreation(CLASS_NAME)
+            Injections.afterNewObjectCreation(this)
+        }
+    }
+
+    private fun inTestThread(batch: Runnable) {
+        tasks.put(batch)
+        completions.take()
+    }
+
+    private object NoOpNoiseInjector : NoiseInjector {
+        override fun beforeSharedMemoryAccess(location: Int) {}
+    }
+
+    private object NoOpEventTracker : EventTracker {
+        private val random = Random(0)
+
+        override fun beforeLock(codeLocation: Int) {}
+        override fun lock(monitor: Any) {}
+        override fun unlock(monitor: Any, codeLocation: Int) {}
+
+        override fun park(codeLocation: Int) {}
+        override fun unpark(thread: Thread, codeLocation: Int) {}
+
+        override fun wait(monitor: Any, withTimeout: Boolean) {}
+        override fun beforeWait(codeLocation: Int) {}
+        override fun notify(monitor: Any, codeLocation: Int, notifyAll: Boolean) {}
+
+        override fun beforeReadField(obj: Any, className: String, fieldName: String, codeLocation: Int) = false
+        override fun beforeReadFieldStatic(className: String, fieldName: String, codeLocation: Int) {}
+        override fun beforeReadFinalFieldStatic(className: String) {}
+        override fun beforeReadArrayElement(array: Any, index: Int, codeLocation: Int) = false
+        override fun afterRead(value: Any?) {}
+
+        override fun beforeWriteField(obj: Any, className: String, fieldName: String, value: Any?, codeLocation: Int) = false
+        override fun beforeWriteFieldStatic(className: String, fieldName: String, value: Any?, codeLocation: Int) {}
+        override fun beforeWriteArrayElement(array: Any, index: Int, value: Any?, codeLocation: Int) = false
+        override fun afterWrite() {}
+
+        override fun beforeMethodCall(owner: Any?, className: String, methodName: String, codeLocation: Int, params: Array<Any?>) {}
+        override fun beforeAtomicMethodCall(owner: Any?, className: String, methodName: String, codeLocation: Int, params: Array<Any?>) {}
+        override fun onMethodCallFinishedSuccessfully(result: Any?) {}
+        override fun onMethodCallThrewException(t: Throwable) {}
+
+        override fun getThreadLocalRandom(): Random = random
+        override fun randomNextInt(): Int = 0
+
+        override fun beforeNewObjectCreation(className: String) {}
+        override fun afterNewObjectCreation(obj: Any) {}
+
+        override fun onWriteToObjectFieldOrArrayCell(receiver: Any, fieldOrArrayCellValue: Any?) {}
+        override fun onWriteObjectToStaticField(fieldValue: Any?) {}
+
+        override fun shouldInvokeBeforeEvent() = false
+        override fun beforeEvent(eventId: Int, type: String) {}
+        override fun getEventId() = 0
+        override fun setLastMethodCallEventId() {}
+    }
+}
+
+private const val BATCH_SIZE = 100_000
+private const val LOCATION = 42
+private const val CLASS_NAME = "org.jetbrains.kotlinx.lincheck_benchmark.InjectionsBenchmark"
+private const val FIELD_NAME = "sink"
+private const val METHOD_NAME = "inTestThread"
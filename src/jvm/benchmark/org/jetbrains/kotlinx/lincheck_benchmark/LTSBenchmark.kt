@@ -0,0 +1,44 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.verifier.linearizability.*
+import org.openjdk.jmh.annotations.*
+import java.util.concurrent.*
+
+/**
+ * Measures the construction of the [LTS][org.jetbrains.kotlinx.lincheck.verifier.LTS]
+ * of the sequential specification: each operation verifies a set of realistic results
+ * with a new verifier, so that all the states and transitions required for them are computed from scratch.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+class LTSBenchmark {
+    private val scenario = benchmarkScenario()
+    private lateinit var results: List<ExecutionResult>
+
+    @Setup
+    fun setup() {
+        results = collectResults(scenario, RESULTS_COUNT)
+    }
+
+    @Benchmark
+    fun buildLTS(): Int {
+        val verifier = LinearizabilityVerifier(BenchmarkQueue::class.java)
+        for (result in results) {
+            check(verifier.verifyResultsImpl(scenario, result)) { "Incorrect results:\n$result" }
+        }
+        return verifier.lts.transitionsCount
+    }
+}
+
+private const val RESULTS_COUNT = 64
@@ -0,0 +1,66 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.jetbrains.kotlinx.lincheck.transformation.*
+import org.objectweb.asm.*
+import org.openjdk.jmh.annotations.*
+import java.util.concurrent.*
+
+/**
+ * Measures the throughput of the bytecode transformation performed by the Lincheck java agent
+ * on a set of commonly instrumented classes, the same way as `LincheckClassFileTransformer` does,
+ * but without the caching of the transformed classes.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.SECONDS)
+class LincheckClassVisitorBenchmark {
+    @Param("STRESS", "MODEL_CHECKING")
+    var mode: String = ""
+
+    private lateinit var instrumentationMode: InstrumentationMode
+    private lateinit var classes: List<ByteArray>
+
+    @Setup
+    fun setup() {
+        instrumentationMode = InstrumentationMode.valueOf(mode)
+        classes = TRANSFORMED_CLASSES.map { className ->
+            val resource = className.replace('.', '/') + ".class"
+            ClassLoader.getSystemClassLoader().getResourceAsStream(resource)!!.use { it.readBytes() }
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(TRANSFORMED_CLASSES_COUNT)
+    fun transformClasses(): Int {
+        var size = 0
+        for (bytes in classes) {
+            val reader = ClassReader(bytes)
+            val writer = SafeClassWriter(reader, ClassLoader.getSystemClassLoader(), ClassWriter.COMPUTE_FRAMES)
+            reader.accept(LincheckClassVisitor(instrumentationMode, writer), ClassReader.SKIP_FRAMES)
+            size += writer.toByteArray().size
+        }
+        return size
+    }
+}
+
+private val TRANSFORMED_CLASSES = listOf(
+    "java.util.ArrayList",
+    "java.util.HashMap",
+    "java.util.concurrent.ConcurrentHashMap",
+    "java.util.concurrent.ConcurrentLinkedQueue",
+    "java.util.concurrent.locks.AbstractQueuedSynchronizer",
+    "kotlinx.coroutines.CancellableContinuationImpl",
+    "kotlinx.coroutines.channels.BufferedChannel",
+    "org.jetbrains.kotlinx.lincheck_benchmark.BenchmarkQueue"
+)
+
+private const val TRANSFORMED_CLASSES_COUNT = 8
@@ -0,0 +1,48 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.verifier.linearizability.*
+import org.openjdk.jmh.annotations.*
+import java.util.concurrent.*
+
+/**
+ * Measures the search for a linearization of realistic results by [LinearizabilityVerifier].
+ * The LTS is constructed in advance and the cache of the already verified results is bypassed,
+ * so that only the search itself is measured; see [LTSBenchmark] for the LTS construction.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+class LinearizabilityVerifierBenchmark {
+    private val scenario = benchmarkScenario()
+    private val verifier = LinearizabilityVerifier(BenchmarkQueue::class.java)
+    private lateinit var results: List<ExecutionResult>
+
+    @Setup
+    fun setup() {
+        results = collectResults(scenario, RESULTS_COUNT)
+        results.forEach { verifier.verifyResultsImpl(scenario, it) }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(RESULTS_COUNT)
+    fun verifyResults(): Int {
+        var correct = 0
+        // Fewer distinct results might have been collected, they are checked in turns then.
+        for (i in 0 until RESULTS_COUNT) {
+            if (verifier.verifyResultsImpl(scenario, results[i % results.size])) correct++
+        }
+        return correct
+    }
+}
+
+private const val RESULTS_COUNT = 64
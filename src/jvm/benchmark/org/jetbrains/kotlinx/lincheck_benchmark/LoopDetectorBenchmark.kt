@@ -0,0 +1,52 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.jetbrains.kotlinx.lincheck.strategy.managed.*
+import org.openjdk.jmh.annotations.*
+import java.util.concurrent.*
+
+/**
+ * Measures the [LoopDetector] bookkeeping performed on each switch point of the model checking,
+ * by replaying the events of an invocation: the threads visit code locations in turns,
+ * with a context switch after every [EVENTS_PER_SWITCH] events.
+ * The same locations are visited repeatedly, but not enough times to detect a spin cycle.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+class LoopDetectorBenchmark {
+    @Param("2", "3")
+    var threads: Int = 0
+
+    @Benchmark
+    @OperationsPerInvocation(EVENTS)
+    fun visitCodeLocations(): Int {
+        val loopDetector = LoopDetector(threads, ManagedCTestConfiguration.DEFAULT_HANGING_DETECTION_THRESHOLD)
+        loopDetector.initialize()
+        var iThread = 0
+        loopDetector.beforePart(iThread)
+        var idleDecisions = 0
+        for (event in 0 until EVENTS) {
+            if (event > 0 && event % EVENTS_PER_SWITCH == 0) {
+                iThread = (iThread + 1) % threads
+                loopDetector.onThreadSwitch(iThread)
+            }
+            val codeLocation = event % CODE_LOCATIONS
+            if (loopDetector.visitCodeLocation(iThread, codeLocation) == LoopDetector.Decision.Idle) idleDecisions++
+            loopDetector.onNextExecutionPoint(codeLocation)
+        }
+        return idleDecisions
+    }
+}
+
+private const val EVENTS = 10_000
+private const val EVENTS_PER_SWITCH = 50
+private const val CODE_LOCATIONS = 20
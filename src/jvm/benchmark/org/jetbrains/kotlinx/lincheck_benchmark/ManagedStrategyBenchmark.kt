@@ -0,0 +1,54 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.*
+import org.jetbrains.kotlinx.lincheck.transformation.*
+import org.jetbrains.kotlinx.lincheck.verifier.linearizability.*
+import org.openjdk.jmh.annotations.*
+import java.util.concurrent.*
+
+/**
+ * Measures the cost of a model checking invocation of the [benchmark scenario][benchmarkScenario].
+ * Every shared memory access of an invocation goes through the injections
+ * to `ManagedStrategy.newSwitchPoint`, which consults the loop detector and the current interleaving;
+ * thus, this benchmark tracks the per-switch-point overhead of the model checking.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+class ManagedStrategyBenchmark {
+    private val scenario = benchmarkScenario()
+    private lateinit var testCfg: ModelCheckingCTestConfiguration
+
+    @Setup
+    fun setup() {
+        LincheckJavaAgent.install(InstrumentationMode.MODEL_CHECKING)
+        testCfg = ModelCheckingOptions()
+            .invocationsPerIteration(INVOCATIONS)
+            .createTestConfigurations(BenchmarkQueue::class.java)
+    }
+
+    @TearDown
+    fun tearDown() {
+        LincheckJavaAgent.uninstall()
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(INVOCATIONS)
+    fun modelCheckingInvocation() {
+        val verifier = LinearizabilityVerifier(BenchmarkQueue::class.java)
+        val strategy = testCfg.createStrategy(BenchmarkQueue::class.java, scenario, null, null, verifier)
+        val failure = strategy.run()
+        check(failure == null) { "The benchmark scenario has failed:\n$failure" }
+    }
+}
+
+private const val INVOCATIONS = 100
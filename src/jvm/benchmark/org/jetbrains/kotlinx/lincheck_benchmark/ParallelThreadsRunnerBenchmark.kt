@@ -0,0 +1,67 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark
+
+import org.jetbrains.kotlinx.lincheck.runner.*
+import org.jetbrains.kotlinx.lincheck.transformation.*
+import org.openjdk.jmh.annotations.*
+import java.util.concurrent.*
+
+/**
+ * Measures a stress mode invocation of the [benchmark scenario][benchmarkScenario]
+ * by [ParallelThreadsRunner.run], including the synchronization of the test threads
+ * between the scenario parts and the collection of the results, but not their verification.
+ * In the lockstep mode, a run executes a batch of invocations, so the executed invocations
+ * are counted separately, see [InvocationCounters].
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+class ParallelThreadsRunnerBenchmark {
+    @Param("false", "true")
+    var lockstep: Boolean = false
+
+    @Param("NEVER", "ALWAYS")
+    var useClocks: String = ""
+
+    private lateinit var runner: ParallelThreadsRunner
+
+    @Setup
+    fun setup() {
+        LincheckJavaAgent.install(InstrumentationMode.STRESS)
+        runner = createRunner(benchmarkScenario(), UseClocks.valueOf(useClocks)).apply {
+            runInLockstep = lockstep
+        }
+    }
+
+    @TearDown
+    fun tearDown() {
+        runner.close()
+        LincheckJavaAgent.uninstall()
+    }
+
+    @Benchmark
+    fun run(counters: InvocationCounters): InvocationResult = runner.run().also {
+        check(it is CompletedInvocationResult) { "The benchmark scenario has failed: $it" }
+        counters.invocations += runner.lastRunInvocationsCount
+    }
+
+    @State(Scope.Thread)
+    @AuxCounters(AuxCounters.Type.OPERATIONS)
+    class InvocationCounters {
+        @JvmField
+        var invocations: Long = 0
+
+        @Setup(Level.Iteration)
+        fun reset() {
+            invocations = 0
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+@file:JvmName("TimeToBugBenchmark")
+
+package org.jetbrains.kotlinx.lincheck_benchmark.timetobug
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import java.io.*
+import java.lang.management.*
+
+/**
+ * Runs the [corpus][TIME_TO_BUG_CORPUS] of buggy implementations under each of the [configurations][TIME_TO_BUG_CONFIGURATIONS]
+ * with the fixed random seeds, and reports how much effort it takes to find the first failure:
+ * the number of invocations, the wall time, and the peak heap usage.
+ * The results are comparable between the runs on the same machine, so that the changes of
+ * the exploration strategies can be evaluated quantitatively.
+ *
+ * Usage: `./gradlew timeToBugBenchmark`; the report is printed, and the raw measurements
+ * are written in the CSV format to the file specified by the first argument, if present.
+ * The number of seeds is specified via `-Dlincheck.timeToBug.seeds`.
+ */
+fun main(args: Array<String>) {
+    val seeds = Integer.getInteger("lincheck.timeToBug.seeds", DEFAULT_SEEDS)
+    val measurements = mutableListOf<TimeToBugMeasurement>()
+    for (testClass in TIME_TO_BUG_CORPUS) {
+        for (configuration in TIME_TO_BUG_CONFIGURATIONS) {
+            for (seed in 0L until seeds) {
+                measurements += measureTimeToBug(testClass, configuration, seed)
+            }
+        }
+    }
+    println(timeToBugReport(measurements))
+    args.firstOrNull()?.let { path ->
+        File(path).apply { parentFile?.mkdirs() }.printWriter().use { out ->
+            out.println(TimeToBugMeasurement.CSV_HEADER)
+            measurements.forEach { out.println(it.toCsv()) }
+        }
+    }
+}
+
+/**
+ * A testing configuration under evaluation; the [common parameters][commonConfiguration]
+ * are the same for all the configurations.
+ */
+internal class TimeToBugConfiguration(
+    val name: String,
+    val createOptions: () -> Options<*, *>
+)
+
+internal val TIME_TO_BUG_CONFIGURATIONS = listOf(
+    TimeToBugConfiguration("stress") {
+        StressOptions().invocationsPerIteration(5_000).commonConfiguration()
+    },
+    TimeToBugConfiguration("stress with noise") {
+        StressOptions().invocationsPerIteration(5_000).noiseProbability(0.1).commonConfiguration()
+    },
+    TimeToBugConfiguration("model checking") {
+        ModelCheckingOptions().invocationsPerIteration(1_000).commonConfiguration()
+    },
+    TimeToBugConfiguration("model checking, coverage-guided") {
+        ModelCheckingOptions().invocationsPerIteration(1_000)
+            .executionGenerator(CoverageGuidedExecutionGenerator::class.java)
+            .commonConfiguration()
+    },
+)
+
+private fun <O : Options<O, *>> O.commonConfiguration(): O = this
+    .iterations(50)
+    .threads(2)
+    .actorsPerThread(3)
+    .actorsBefore(1)
+    .actorsAfter(1)
+    .minimizeFailedScenario(false)
+    .invocationTimeout(1_000)
+
+internal class TimeToBugMeasurement(
+    val testClass: Class<*>,
+    val configuration: String,
+    val seed: Long,
+    /** The failure type, or `null` if the bug has not been found. */
+    val failure: String?,
+    val invocations: Long,
+    val wallTimeMs: Long,
+    val peakHeapBytes: Long
+) {
+    fun toCsv() = listOf(testClass.simpleName, configuration, seed, failure.orEmpty(), invocations, wallTimeMs, peakHeapBytes)
+        .joinToString(",") { "\"$it\"" }
+
+    companion object {
+        const val CSV_HEADER = "test,configuration,seed,failure,invocations,wallTimeMs,peakHeapBytes"
+    }
+}
+
+internal fun measureTimeToBug(testClass: Class<*>, configuration: TimeToBugConfiguration, seed: Long): TimeToBugMeasurement {
+    System.setProperty(RANDOM_SEED_PROPERTY, seed.toString())
+    val linChecker = LinChecker(testClass, configuration.createOptions())
+    // Start each run from a comparable heap state.
+    System.gc()
+    val heapPools = ManagementFactory.getMemoryPoolMXBeans().filter { it.type == MemoryType.HEAP }
+    heapPools.forEach { it.resetPeakUsage() }
+    val start = System.nanoTime()
+    val failure = linChecker.checkImpl()
+    val wallTimeMs = (System.nanoTime() - start) / 1_000_000
+    return TimeToBugMeasurement(
+        testClass = testClass,
+        configuration = configuration.name,
+        seed = seed,
+        failure = failure?.let { it::class.simpleName },
+        invocations = linChecker.statistics.invocationsCount,
+        wallTimeMs = wallTimeMs,
+        peakHeapBytes = heapPools.sumOf { it.peakUsage.used }
+    )
+}
+
+/**
+ * Aggregates the measurements over the seeds: how many runs have found the bug,
+ * the median effort of the successful runs, and the maximal peak heap usage.
+ */
+internal fun timeToBugReport(measurements: List<TimeToBugMeasurement>): String {
+    val header = listOf("test", "configuration", "found", "median invocations", "median time, ms", "max heap, MB")
+    val rows = measurements.groupBy { it.testClass to it.configuration }.map { (key, runs) ->
+        val found = runs.filter { it.failure != null }
+        listOf(
+            key.first.simpleName,
+            key.second,
+            "${found.size} / ${runs.size}",
+            found.map { it.invocations }.median()?.toString() ?: "-",
+            found.map { it.wallTimeMs }.median()?.toString() ?: "-",
+            (runs.maxOf { it.peakHeapBytes } / (1024 * 1024)).toString()
+        )
+    }
+    val columns = header.indices.map { column -> listOf(header[column]) + rows.map { it[column] } }
+    return columnsToString(columns)
+}
+
+private fun List<Long>.median(): Long? = if (isEmpty()) null else sorted()[size / 2]
+
+private const val DEFAULT_SEEDS = 5
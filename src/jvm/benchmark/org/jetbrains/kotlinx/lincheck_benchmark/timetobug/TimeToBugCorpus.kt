@@ -0,0 +1,57 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_benchmark.timetobug
+
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck_corpus.*
+
+/**
+ * The known-buggy implementations used to measure how fast the testing strategies find the bugs;
+ * they are shared with the Lincheck tests, see `src/jvm/corpus`.
+ * They range from the bugs which manifest in most interleavings to the ones that
+ * require a specific interleaving of several operations.
+ */
+internal val TIME_TO_BUG_CORPUS: List<Class<*>> = listOf(
+    CounterWrong0Subject::class.java,
+    CounterWrong2Subject::class.java,
+    FAAQueueSubject::class.java,
+    ManySwitchBug::class.java
+)
+
+/**
+ * The increment of a plain field is a non-atomic read-modify-write, so that concurrent increments are lost.
+ */
+class CounterWrong0Subject : CounterSubject(CounterWrong0())
+
+/**
+ * The same bug with a volatile field, so that only the interleavings of the increments expose it.
+ */
+class CounterWrong2Subject : CounterSubject(CounterWrong2())
+
+abstract class CounterSubject(private val counter: Counter) {
+    @Operation
+    fun incAndGet(): Int = counter.incAndGet()
+
+    @Operation
+    fun get(): Int = counter.get()
+}
+
+/**
+ * The bug requires several enqueues and dequeues in a specific interleaving.
+ */
+class FAAQueueSubject {
+    private val queue = FAAQueue<Int>()
+
+    @Operation
+    fun enqueue(x: Int) = queue.enqueue(x)
+
+    @Operation
+    fun dequeue() = queue.dequeue()
+}
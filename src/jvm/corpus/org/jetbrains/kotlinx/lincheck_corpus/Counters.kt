@@ -0,0 +1,52 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_corpus
+
+import java.util.concurrent.atomic.*
+
+/**
+ * The counters with the known bugs, and a correct one.
+ */
+interface Counter {
+    fun incAndGet(): Int
+    fun get(): Int
+}
+
+class CounterWrong0 : Counter {
+    private var c: Int = 0
+
+    override fun incAndGet(): Int = ++c
+    override fun get(): Int = c
+}
+
+class CounterWrong1 : Counter {
+    private var c: Int = 0
+
+    override fun incAndGet(): Int {
+        c++
+        return c
+    }
+    override fun get(): Int = c
+}
+
+class CounterWrong2 : Counter {
+    @Volatile
+    private var c: Int = 0
+
+    override fun incAndGet(): Int = ++c
+    override fun get(): Int = c
+}
+
+class CounterCorrect : Counter {
+    private val c = AtomicInteger()
+
+    override fun incAndGet(): Int = c.incrementAndGet()
+    override fun get(): Int = c.get()
+}
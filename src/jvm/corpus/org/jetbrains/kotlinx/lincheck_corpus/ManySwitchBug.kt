@@ -0,0 +1,51 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_corpus
+
+import org.jetbrains.kotlinx.lincheck.annotations.*
+
+/**
+ * The error is reachable only by an interleaving with many context switches
+ * between [foo] and [bar], each at a specific point.
+ */
+class ManySwitchBug {
+    private var canEnterSection1 = false
+    private var canEnterSection2 = false
+    private var canEnterSection3 = false
+    private var canEnterSection4 = false
+    private var canEnterSection5 = false
+
+    @Operation
+    fun foo() {
+        canEnterSection1 = true
+        canEnterSection1 = false
+        if (canEnterSection2) {
+            canEnterSection3 = true
+            canEnterSection3 = false
+            if (canEnterSection4) {
+                canEnterSection5 = true
+                canEnterSection5 = false
+            }
+        }
+    }
+
+    @Operation
+    fun bar() {
+        if (canEnterSection1) {
+            canEnterSection2 = true
+            canEnterSection2 = false
+            if (canEnterSection3) {
+                canEnterSection4 = true
+                canEnterSection4 = false
+                if (canEnterSection5) error("Can't enter here")
+            }
+        }
+    }
+}
@@ -35,7 +35,8 @@ abstract class CTestConfiguration(
     val minimizeFailedScenario: Boolean,
     val sequentialSpecification: Class<*>,
     val timeoutMs: Long,
-    val customScenarios: List<ExecutionScenario>
+    val customScenarios: List<ExecutionScenario>,
+    val testingTimeMs: Long = NO_TESTING_TIME_LIMIT
 ) {
 
     /**
@@ -58,6 +59,7 @@ abstract class CTestConfiguration(
         val DEFAULT_VERIFIER: Class<out Verifier> = LinearizabilityVerifier::class.java
         const val DEFAULT_MINIMIZE_ERROR = true
         const val DEFAULT_TIMEOUT_MS: Long = 10000
+        const val NO_TESTING_TIME_LIMIT: Long = 0
     }
 }
 
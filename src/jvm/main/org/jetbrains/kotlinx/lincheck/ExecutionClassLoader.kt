@@ -13,8 +13,8 @@ package org.jetbrains.kotlinx.lincheck
 import org.jetbrains.kotlinx.lincheck.runner.TestThreadExecution
 
 /**
- * This classloader is mostly used by runner to separate parallel iterations,
- * and define generated [test executions][TestThreadExecution].
+ * This classloader is used to define generated [test executions][TestThreadExecution],
+ * which are shared among all the runners.
  */
 class ExecutionClassLoader : ClassLoader() {
     fun defineClass(className: String?, bytecode: ByteArray): Class<out TestThreadExecution?> {
@@ -13,6 +13,7 @@ import org.jetbrains.kotlinx.lincheck.annotations.*
 import org.jetbrains.kotlinx.lincheck.annotations.Operation
 import org.jetbrains.kotlinx.lincheck.execution.*
 import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.transformation.LincheckClassFileTransformer
 import org.jetbrains.kotlinx.lincheck.transformation.withLincheckJavaAgent
 import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.ModelCheckingCTestConfiguration
 import org.jetbrains.kotlinx.lincheck.verifier.*
@@ -25,9 +26,19 @@ class LinChecker (private val testClass: Class<*>, options: Options<*, *>?) {
     private val testStructure = CTestStructure.getFromTestClass(testClass)
     private val testConfigurations: List<CTestConfiguration>
     private val reporter: Reporter
+    private val statisticsListener: ((LincheckStatistics) -> Unit)?
+    private val scenariosStatistics = mutableListOf<ScenarioStatistics>()
+    private var scenarioSpaceExhausted: Boolean? = null
+
+    /**
+     * Statistics of the last [checkImpl] run.
+     */
+    internal lateinit var statistics: LincheckStatistics
+        private set
 
     init {
         val logLevel = options?.logLevel ?: testClass.getAnnotation(LogLevel::class.java)?.value ?: DEFAULT_LOG_LEVEL
+        statisticsListener = options?.statisticsListener
         reporter = Reporter(logLevel)
         testConfigurations = if (options != null) listOf(options.createTestConfigurations(testClass))
                              else createFromTestClassAnnotations(testClass)
@@ -53,13 +64,29 @@ class LinChecker (private val testClass: Class<*>, options: Options<*, *>?) {
     internal fun checkImpl(): LincheckFailure? {
         check(testConfigurations.isNotEmpty()) { "No Lincheck test configuration to run" }
         lincheckVerificationStarted()
-        for (testCfg in testConfigurations) {
-            withLincheckJavaAgent(testCfg.instrumentationMode) {
-                val failure = testCfg.checkImpl()
-                if (failure != null) return failure
+        scenariosStatistics.clear()
+        scenarioSpaceExhausted = null
+        val startTime = System.nanoTime()
+        val initialTransformedClassesCount = LincheckClassFileTransformer.transformedClassesCount.get()
+        val initialTransformationTimeNanos = LincheckClassFileTransformer.transformationTimeNanos.get()
+        try {
+            for (testCfg in testConfigurations) {
+                withLincheckJavaAgent(testCfg.instrumentationMode) {
+                    val failure = testCfg.checkImpl()
+                    if (failure != null) return failure
+                }
             }
+            return null
+        } finally {
+            statistics = LincheckStatistics(
+                scenarios = scenariosStatistics.toList(),
+                transformedClassesCount = LincheckClassFileTransformer.transformedClassesCount.get() - initialTransformedClassesCount,
+                transformationTimeNanos = LincheckClassFileTransformer.transformationTimeNanos.get() - initialTransformationTimeNanos,
+                runningTimeNanos = System.nanoTime() - startTime,
+                scenarioSpaceExhausted = scenarioSpaceExhausted
+            )
+            statisticsListener?.invoke(statistics)
         }
-        return null
     }
 
     private fun CTestConfiguration.checkImpl(): LincheckFailure? {
@@ -69,35 +96,44 @@ class LinChecker (private val testClass: Class<*>, options: Options<*, *>?) {
             val scenario = customScenarios[i]
             scenario.validate()
             reporter.logIteration(i + 1, customScenarios.size, scenario)
-            val failure = scenario.run(this, verifier)
+            val failure = scenario.run(this, verifier, ScenarioKind.CUSTOM)
             if (failure != null) {
                 runReplayForPlugin(failure, verifier)
                 return failure
             }
         }
         checkAtLeastOneMethodIsMarkedAsOperation(testClass)
-        var verifier = createVerifier()
-        repeat(iterations) { i ->
-            // For performance reasons, verifier re-uses LTS from previous iterations.
-            // This behaviour is similar to a memory leak and can potentially cause OutOfMemoryError.
-            // This is why we periodically create a new verifier to still have increased performance
-            // from re-using LTS and limit the size of potential memory leak.
-            // https://github.com/Kotlin/kotlinx-lincheck/issues/124
-            if ((i + 1) % VERIFIER_REFRESH_CYCLE == 0)
-                verifier = createVerifier()
+        // For performance reasons, verifier re-uses LTS from previous iterations.
+        // The number of states cached by LTS is bounded, so the same verifier
+        // can be used for all the iterations without a risk of OutOfMemoryError.
+        // https://github.com/Kotlin/kotlinx-lincheck/issues/124
+        val verifier = createVerifier()
+        // In the time-budgeted mode, the scenarios are generated until the testing time is over.
+        val planner = if (testingTimeMs > 0) TestingTimePlanner(testingTimeMs, iterations) else null
+        var i = 0
+        if (exGen is ExhaustiveExecutionGenerator) scenarioSpaceExhausted = false
+        while (planner?.hasTimeForNextIteration() ?: (i < iterations)) {
+            if (!exGen.hasNextExecution()) break
             val scenario = exGen.nextExecution()
             scenario.validate()
-            reporter.logIteration(i + 1 + customScenarios.size, iterations, scenario)
-            val failure = scenario.run(this, verifier)
+            reporter.logIteration(++i + customScenarios.size, iterations, scenario)
+            val failure = scenario.run(this, verifier, ScenarioKind.GENERATED, planner)
             if (failure != null) {
                 val minimizedFailedIteration = if (!minimizeFailedScenario) failure else failure.minimize(this)
                 reporter.logFailedIteration(minimizedFailedIteration)
                 runReplayForPlugin(minimizedFailedIteration, verifier)
                 return minimizedFailedIteration
             }
+            exGen.onScenarioTested(scenario, verifier)
             // Reset the parameter generator ranges to start with the same initial bounds on each scenario generation.
             testStructure.parameterGenerators.forEach { it.reset() }
         }
+        planner?.let { reporter.logTestingTimeStatistics(it) }
+        if (exGen is ExhaustiveExecutionGenerator) {
+            // The iterations limit may be reached before all the scenarios within the bounds are tested.
+            scenarioSpaceExhausted = exGen.isExhausted
+            reporter.logScenarioSpaceExploration(i, exGen.isExhausted)
+        }
         return null
     }
 
@@ -110,7 +146,7 @@ class LinChecker (private val testClass: Class<*>, options: Options<*, *>?) {
         if (ideaPluginEnabled() && this is ModelCheckingCTestConfiguration) {
             reporter.logFailedIteration(failure, loggingLevel = LoggingLevel.WARN)
             enableReplayModeForIdeaPlugin()
-            failure.scenario.run(this, verifier)
+            failure.scenario.run(this, verifier, ScenarioKind.REPLAY)
         } else {
             reporter.logFailedIteration(failure)
         }
@@ -136,21 +172,44 @@ class LinChecker (private val testClass: Class<*>, options: Options<*, *>?) {
         for (i in threads.indices.reversed()) {
             for (j in threads[i].indices.reversed()) {
                 tryMinimize(i, j)
-                    ?.run(testCfg, testCfg.createVerifier())
+                    ?.run(testCfg, testCfg.createVerifier(), ScenarioKind.MINIMIZATION)
                     ?.let { return it }
             }
         }
         return null
     }
 
-    private fun ExecutionScenario.run(testCfg: CTestConfiguration, verifier: Verifier): LincheckFailure? =
-        testCfg.createStrategy(
+    private fun ExecutionScenario.run(
+        testCfg: CTestConfiguration,
+        verifier: Verifier,
+        kind: ScenarioKind,
+        planner: TestingTimePlanner? = null
+    ): LincheckFailure? {
+        val strategy = testCfg.createStrategy(
             testClass = testClass,
             scenario = this,
             validationFunction = testStructure.validationFunction,
             stateRepresentationMethod = testStructure.stateRepresentation,
             verifier = verifier
-        ).run()
+        )
+        val startTime = System.nanoTime()
+        return try {
+            if (planner != null) planner.runIteration(strategy) else strategy.run()
+        } finally {
+            scenariosStatistics += ScenarioStatistics(
+                scenario = this,
+                kind = kind,
+                invocationsCount = strategy.invocationsCount,
+                runningTimeNanos = System.nanoTime() - startTime,
+                verificationsCount = strategy.verificationsCount,
+                verificationTimeNanos = strategy.verificationTimeNanos,
+                switchPointsCount = strategy.switchPointsCount,
+                livelockReplaysCount = strategy.livelockReplaysCount,
+                interleavingTreeSize = strategy.interleavingTreeSize,
+                ltsStatesCount = (verifier as? AbstractLTSVerifier)?.lts?.statesCount ?: 0
+            )
+        }
+    }
 
     private fun CTestConfiguration.createVerifier() =
         verifierClass.getConstructor(Class::class.java).newInstance(sequentialSpecification)
@@ -179,8 +238,6 @@ class LinChecker (private val testClass: Class<*>, options: Options<*, *>?) {
         fun check(testClass: Class<*>, options: Options<*, *>? = null) {
             LinChecker(testClass, options).check()
         }
-
-        private const val VERIFIER_REFRESH_CYCLE = 100
     }
 }
 
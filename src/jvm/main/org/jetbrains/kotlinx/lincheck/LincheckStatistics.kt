@@ -0,0 +1,140 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck
+
+import org.jetbrains.kotlinx.lincheck.execution.*
+
+/**
+ * Statistics of a Lincheck test run, which show where the testing time goes.
+ * It is passed to the [statistics listener][Options.statisticsListener]
+ * when the run completes, whether the test has passed or failed.
+ */
+class LincheckStatistics internal constructor(
+    /**
+     * Statistics of each scenario run, in the order of the runs.
+     */
+    val scenarios: List<ScenarioStatistics>,
+    /**
+     * The number of classes transformed by the Lincheck java agent during the run;
+     * the classes transformed by the previous runs are cached and not counted.
+     */
+    val transformedClassesCount: Int,
+    /**
+     * The total time of the classes transformation, in nanoseconds.
+     */
+    val transformationTimeNanos: Long,
+    /**
+     * The total time of the run, in nanoseconds.
+     */
+    val runningTimeNanos: Long,
+    /**
+     * `true` if the [exhaustive execution generator][ExhaustiveExecutionGenerator] has enumerated
+     * all the scenarios within the bounds, `false` if it has been stopped by the iterations limit
+     * or by a failure, and `null` if another execution generator is used.
+     */
+    val scenarioSpaceExhausted: Boolean? = null
+) {
+    /**
+     * The total number of invocations of all the scenarios.
+     */
+    val invocationsCount: Long get() = scenarios.sumOf { it.invocationsCount.toLong() }
+
+    /**
+     * Returns statistics of the scenario runs of the specified [kind].
+     */
+    fun scenarios(kind: ScenarioKind): List<ScenarioStatistics> = scenarios.filter { it.kind == kind }
+
+    override fun toString(): String {
+        val header = listOf(
+            "scenarios", "runs", "invocations", "time, ms", "verifications", "verification time, ms",
+            "switch points", "livelock replays", "max tree size", "max LTS states"
+        )
+        val rows = ScenarioKind.values().mapNotNull { kind ->
+            val runs = scenarios(kind).takeIf { it.isNotEmpty() } ?: return@mapNotNull null
+            listOf(
+                kind.name.lowercase(),
+                runs.size,
+                runs.sumOf { it.invocationsCount.toLong() },
+                runs.sumOf { it.runningTimeNanos } / 1_000_000,
+                runs.sumOf { it.verificationsCount.toLong() },
+                runs.sumOf { it.verificationTimeNanos } / 1_000_000,
+                runs.sumOf { it.switchPointsCount },
+                runs.sumOf { it.livelockReplaysCount.toLong() },
+                runs.maxOf { it.interleavingTreeSize },
+                runs.maxOf { it.ltsStatesCount }
+            )
+        }
+        val columns = header.indices.map { column -> listOf<Any>(header[column]) + rows.map { it[column] } }
+        return "Completed in ${runningTimeNanos / 1_000_000} ms, " +
+               "classes transformed: $transformedClassesCount in ${transformationTimeNanos / 1_000_000} ms\n" +
+               columnsToString(columns)
+    }
+}
+
+/**
+ * Statistics of a single [scenario] run by the testing strategy.
+ */
+class ScenarioStatistics internal constructor(
+    val scenario: ExecutionScenario,
+    val kind: ScenarioKind,
+    /**
+     * The number of invocations; the livelock replays are not counted.
+     */
+    val invocationsCount: Int,
+    /**
+     * The total time of the scenario run, including the results verification, in nanoseconds.
+     */
+    val runningTimeNanos: Long,
+    /**
+     * The number of the invocation results verifications.
+     */
+    val verificationsCount: Int,
+    /**
+     * The total time of the results verification, in nanoseconds.
+     * In the pipelined stress mode, the results are verified in parallel with the invocations.
+     */
+    val verificationTimeNanos: Long,
+    /**
+     * The number of switch points passed in the model checking mode, `0` in the stress mode.
+     */
+    val switchPointsCount: Long,
+    /**
+     * The number of invocations re-run in the model checking mode after a livelock has been detected.
+     */
+    val livelockReplaysCount: Int,
+    /**
+     * The number of nodes in the interleaving tree built in the model checking mode, `0` in the stress mode.
+     */
+    val interleavingTreeSize: Int,
+    /**
+     * The number of states in the labeled transition system of the verifier, `0` if the verifier does not use it.
+     * The transition system is shared between the scenarios, so this number accumulates the previous runs.
+     */
+    val ltsStatesCount: Int
+) {
+    /**
+     * The time of the scenario run excluding the results verification, in nanoseconds.
+     */
+    val executionTimeNanos: Long get() = (runningTimeNanos - verificationTimeNanos).coerceAtLeast(0)
+}
+
+/**
+ * Describes why the scenario was run.
+ */
+enum class ScenarioKind {
+    /** A scenario added via [Options.addCustomScenario]. */
+    CUSTOM,
+    /** A scenario produced by the execution generator. */
+    GENERATED,
+    /** A candidate scenario checked during the failed scenario minimization. */
+    MINIMIZATION,
+    /** A re-run of the failed scenario for the Lincheck IDEA plugin. */
+    REPLAY
+}
@@ -18,6 +18,7 @@ import org.jetbrains.kotlinx.lincheck.verifier.*
  */
 abstract class Options<OPT : Options<OPT, CTEST>, CTEST : CTestConfiguration> {
     internal var logLevel = DEFAULT_LOG_LEVEL
+    internal var statisticsListener: ((LincheckStatistics) -> Unit)? = null
     protected var iterations = CTestConfiguration.DEFAULT_ITERATIONS
     protected var threads = CTestConfiguration.DEFAULT_THREADS
     protected var actorsPerThread = CTestConfiguration.DEFAULT_ACTORS_PER_THREAD
@@ -29,6 +30,7 @@ abstract class Options<OPT : Options<OPT, CTEST>, CTEST : CTestConfiguration> {
     protected var sequentialSpecification: Class<*>? = null
     protected var timeoutMs: Long = CTestConfiguration.DEFAULT_TIMEOUT_MS
     protected var customScenarios: MutableList<ExecutionScenario> = mutableListOf()
+    protected var testingTimeMs: Long = CTestConfiguration.NO_TESTING_TIME_LIMIT
 
     /**
      * Number of different test scenarios to be executed
@@ -119,6 +121,20 @@ abstract class Options<OPT : Options<OPT, CTEST>, CTEST : CTestConfiguration> {
         this.minimizeFailedScenario = minimizeFailedScenario
     }
 
+    /**
+     * Test the data structure for the specified amount of time instead of a fixed amount of work.
+     * New scenarios are generated until the time is over, while the time spent on each scenario
+     * is adapted to the observed invocation cost and, for the model checking, to the exploration progress:
+     * the time left by the completely explored scenarios is redistributed among the next ones.
+     * In this mode, [iterations] specifies the expected number of scenarios, used to plan the time per scenario,
+     * and the number of invocations per iteration is ignored. The minimization of a failed scenario
+     * is not limited by the testing time.
+     */
+    fun testingTimeInSeconds(timeInSeconds: Long): OPT = applyAndCast {
+        require(timeInSeconds > 0) { "The testing time should be positive, but $timeInSeconds is found" }
+        this.testingTimeMs = timeInSeconds * 1000
+    }
+
     abstract fun createTestConfigurations(testClass: Class<*>): CTEST
 
     /**
@@ -128,6 +144,14 @@ abstract class Options<OPT : Options<OPT, CTEST>, CTEST : CTestConfiguration> {
         this.logLevel = logLevel
     }
 
+    /**
+     * The specified [listener] receives the [statistics][LincheckStatistics] of the test run
+     * when it completes, whether the test has passed or failed.
+     */
+    fun statisticsListener(listener: (LincheckStatistics) -> Unit): OPT = applyAndCast {
+        this.statisticsListener = listener
+    }
+
     /**
      * The specified class defines the sequential behavior of the testing data structure;
      * it is used by [Verifier] to build a labeled transition system,
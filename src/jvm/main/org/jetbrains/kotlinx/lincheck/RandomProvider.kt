@@ -12,7 +12,13 @@ package org.jetbrains.kotlinx.lincheck
 
 import java.util.Random
 
-private const val SEED_GENERATOR_SEED = 0L
+/**
+ * The seed of the random choices made by Lincheck, so that the test runs are reproducible.
+ * It can be changed via `-Dlincheck.randomSeed`, e.g., to evaluate the testing strategies on several seeds.
+ */
+internal val randomSeed: Long get() = java.lang.Long.getLong(RANDOM_SEED_PROPERTY, 0L)
+
+internal const val RANDOM_SEED_PROPERTY = "lincheck.randomSeed"
 
 /**
  * Used to provide [Random] with different seeds to parameters generators and method generator
@@ -20,7 +26,7 @@ private const val SEED_GENERATOR_SEED = 0L
  */
 class RandomProvider {
 
-    private val seedGenerator = Random(SEED_GENERATOR_SEED)
+    private val seedGenerator = Random(randomSeed)
 
     fun createRandom(): Random = Random(seedGenerator.nextLong())
 }
\ No newline at end of file
@@ -36,6 +36,26 @@ class Reporter(private val logLevel: LoggingLevel) {
         appendExecutionScenario(scenario)
     }
 
+    internal fun logTestingTimeStatistics(planner: TestingTimePlanner) = log(INFO) {
+        appendLine("\n= Testing completed in ${planner.elapsedTimeMs} ms =")
+        appendLine("Scenarios tested: ${planner.iterations}, invocations: ${planner.invocations}, " +
+                   "average invocation time: ${planner.averageInvocationNanos / 1000} us")
+        if (planner.exploredIterations > 0) {
+            appendLine("Fully explored scenarios: ${planner.fullyExploredIterations} / ${planner.exploredIterations}, " +
+                       "average fraction of explored interleavings: ${"%.2f".format(planner.averageExploredFraction)}, " +
+                       "maximal number of context switches: ${planner.maxSwitches}")
+        }
+    }
+
+    internal fun logScenarioSpaceExploration(testedScenarios: Int, exhausted: Boolean) = log(if (exhausted) INFO else WARN) {
+        if (exhausted) {
+            appendLine("\nAll the $testedScenarios scenarios within the bounds have been tested")
+        } else {
+            appendLine("\nOnly $testedScenarios scenarios within the bounds have been tested before reaching the iterations limit; " +
+                       "increase the number of iterations to test all of them")
+        }
+    }
+
     private inline fun log(logLevel: LoggingLevel, crossinline msg: StringBuilder.() -> Unit): Unit = synchronized(this) {
         if (this.logLevel > logLevel) return
         val sb = StringBuilder()
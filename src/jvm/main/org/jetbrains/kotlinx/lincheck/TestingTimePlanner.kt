@@ -0,0 +1,117 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck
+
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import kotlin.math.*
+
+/**
+ * Distributes the testing time between new scenarios and more invocations of each scenario.
+ *
+ * The time left is split evenly between the [expected number of scenarios][expectedIterations]
+ * which have not been tested yet, so that the time left by the scenarios which have been
+ * explored completely is redistributed among the next ones; when more scenarios than expected
+ * can be tested, each of them gets the initially planned share of time. However, each scenario gets
+ * enough time for at least [MIN_INVOCATIONS_PER_ITERATION] invocations of the observed average cost,
+ * so that the expensive scenarios are studied deeper at the cost of testing fewer of them.
+ */
+internal class TestingTimePlanner(
+    private val testingTimeMs: Long,
+    private val expectedIterations: Int
+) {
+    private val startNanos = System.nanoTime()
+    private val deadlineNanos = startNanos + testingTimeMs * 1_000_000
+
+    /**
+     * The number of tested scenarios.
+     */
+    var iterations = 0
+        private set
+
+    /**
+     * The total number of invocations of the tested scenarios.
+     */
+    var invocations = 0L
+        private set
+
+    private var invocationsTimeNanos = 0L
+
+    /**
+     * The number of scenarios reporting their [exploration progress][Strategy.explorationProgress].
+     */
+    var exploredIterations = 0
+        private set
+
+    /**
+     * The number of scenarios with all the interleavings studied.
+     */
+    var fullyExploredIterations = 0
+        private set
+
+    /**
+     * The maximal number of context switches reached by the interleavings exploration.
+     */
+    var maxSwitches = 0
+        private set
+
+    private var exploredFractionsSum = 0.0
+
+    /**
+     * The average fraction of the studied interleavings, with the number of context switches
+     * that has been reached, among the scenarios reporting their exploration progress.
+     */
+    val averageExploredFraction: Double get() =
+        if (exploredIterations == 0) 0.0 else exploredFractionsSum / exploredIterations
+
+    /**
+     * The average time of an invocation, or `0` if no invocation has been performed.
+     */
+    val averageInvocationNanos: Long get() =
+        if (invocations == 0L) 0 else invocationsTimeNanos / invocations
+
+    val elapsedTimeMs: Long get() = (System.nanoTime() - startNanos) / 1_000_000
+
+    fun hasTimeForNextIteration(): Boolean = System.nanoTime() < deadlineNanos
+
+    /**
+     * Runs the [strategy] within the time planned for the next scenario.
+     */
+    fun runIteration(strategy: Strategy): LincheckFailure? {
+        val start = System.nanoTime()
+        strategy.invocationsDeadlineNanos = start + nextIterationTimeNanos(start)
+        try {
+            return strategy.run()
+        } finally {
+            onIterationFinished(strategy, System.nanoTime() - start)
+        }
+    }
+
+    private fun nextIterationTimeNanos(now: Long): Long {
+        val remainingTime = max(deadlineNanos - now, 0)
+        val remainingIterations = expectedIterations - iterations
+        val plannedTime = if (remainingIterations > 0) remainingTime / remainingIterations
+                          else testingTimeMs * 1_000_000 / max(expectedIterations, 1)
+        val minTime = averageInvocationNanos * MIN_INVOCATIONS_PER_ITERATION
+        return min(max(plannedTime, minTime), remainingTime)
+    }
+
+    private fun onIterationFinished(strategy: Strategy, timeNanos: Long) {
+        iterations++
+        invocations += strategy.invocationsCount
+        invocationsTimeNanos += timeNanos
+        val progress = strategy.explorationProgress ?: return
+        exploredIterations++
+        exploredFractionsSum += progress.exploredFraction
+        maxSwitches = max(maxSwitches, progress.maxSwitches)
+        if (progress.isFullyExplored) fullyExploredIterations++
+    }
+}
+
+private const val MIN_INVOCATIONS_PER_ITERATION = 100
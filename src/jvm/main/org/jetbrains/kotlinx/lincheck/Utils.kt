@@ -19,6 +19,7 @@ import org.jetbrains.kotlinx.lincheck.util.UnsafeHolder
 import org.jetbrains.kotlinx.lincheck.verifier.*
 import java.io.PrintWriter
 import java.io.StringWriter
+import java.lang.invoke.*
 import java.lang.ref.*
 import java.lang.reflect.*
 import java.lang.reflect.Method
@@ -32,33 +33,54 @@ fun chooseSequentialSpecification(sequentialSpecificationByUser: Class<*>?, test
     else sequentialSpecificationByUser
 
 /**
- * Executes the specified actor on the sequential specification instance and returns its result.
+ * Executes actors of the specified [method][actorMethod] on instances of the [instanceClass].
+ *
+ * The method is bound into a [MethodHandle] once, which spreads the arguments of each invocation,
+ * so that invocations do not go through reflection. The invoker depends only on the method,
+ * so that one invoker serves all the actors of this method regardless of their arguments.
  */
-internal fun executeActor(
-    instance: Any,
-    actor: Actor,
-    completion: Continuation<Any?>?
-): Result {
-    try {
-        val m = getMethod(instance, actor.method)
-        val args = (if (actor.isSuspendable) actor.arguments + completion else actor.arguments)
-        val res = m.invoke(instance, *args.toTypedArray())
-        return if (m.returnType.isAssignableFrom(Void.TYPE)) VoidResult else createLincheckResult(res)
-    } catch (invE: Throwable) {
-        // If the exception is thrown not during the method invocation - fail immediately
-        if (invE !is InvocationTargetException)
-            throw invE
-        // Exception thrown not during the method invocation should contain underlying exception
-        return ExceptionResult.create(
-            invE.cause?.takeIf { exceptionCanBeValidExecutionResult(it) }
-                ?: throw invE
-        )
+internal class ActorInvoker(instanceClass: Class<*>, private val actorMethod: Method) {
+    private val method: Method = rethrowBindingErrors { getMethod(instanceClass, actorMethod) }
+
+    private val parameterCount = method.parameterCount
+
+    private val handle: MethodHandle = rethrowBindingErrors {
+        MethodHandles.lookup().unreflect(method)
+            .asSpreader(Array<Any?>::class.java, parameterCount)
+            .asType(MethodType.methodType(Any::class.java, Any::class.java, Array<Any?>::class.java))
+    }
+
+    private val isVoid = method.returnType.isAssignableFrom(Void.TYPE)
+
+    /**
+     * Invokes the [actor], which method should be the one of this invoker, on the [instance];
+     * the [completion] is passed as the last argument if the actor is suspendable.
+     */
+    fun invoke(instance: Any, actor: Actor, completion: Continuation<Any?>?): Result {
+        val arguments = arrayOfNulls<Any?>(parameterCount)
+        for (i in actor.arguments.indices) arguments[i] = actor.arguments[i]
+        if (completion != null) arguments[parameterCount - 1] = completion
+        val res: Any? = try {
+            handle.invokeExact(instance, arguments) as Any?
+        } catch (e: Throwable) {
+            // Unlike reflection, method handles do not wrap the exceptions thrown by the method,
+            // so the exceptions which cannot be valid results are wrapped here to be reported in the same way.
+            return ExceptionResult.create(
+                e.takeIf { exceptionCanBeValidExecutionResult(it) }
+                    ?: throw InvocationTargetException(e)
+            )
+        }
+        return if (isVoid) VoidResult else createLincheckResult(res)
+    }
+
+    private inline fun <T> rethrowBindingErrors(bind: () -> T): T = try {
+        bind()
     } catch (e: Exception) {
         e.catch(
             NoSuchMethodException::class.java,
             IllegalAccessException::class.java
         ) {
-            throw IllegalStateException("Cannot invoke method " + actor.method, e)
+            throw IllegalStateException("Cannot invoke method $actorMethod", e)
         }
     }
 }
@@ -68,11 +90,16 @@ private val methodsCache = WeakHashMap<Class<*>, WeakHashMap<Method, WeakReferen
 /**
  * Get the same [method] for [instance] solving the different class loaders problem.
  */
+internal fun getMethod(instance: Any, method: Method): Method = getMethod(instance.javaClass, method)
+
+/**
+ * Get the same [method] for the [instanceClass] solving the different class loaders problem.
+ */
 @Synchronized
-internal fun getMethod(instance: Any, method: Method): Method {
-    val methods = methodsCache.computeIfAbsent(instance.javaClass) { WeakHashMap() }
+internal fun getMethod(instanceClass: Class<*>, method: Method): Method {
+    val methods = methodsCache.computeIfAbsent(instanceClass) { WeakHashMap() }
     return methods[method]?.get() ?: run {
-        val m = instance.javaClass.getMethod(method.name, method.parameterTypes)
+        val m = instanceClass.getMethod(method.name, method.parameterTypes)
         methods[method] = WeakReference(m)
         m
     }
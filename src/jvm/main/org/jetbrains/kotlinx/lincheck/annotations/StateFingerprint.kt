@@ -0,0 +1,28 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.annotations
+
+import kotlin.annotation.AnnotationRetention.*
+import kotlin.annotation.AnnotationTarget.*
+
+/**
+ * During verification, *lincheck* merges equivalent states of the sequential specification.
+ * By default, two instances are considered equivalent if they are equal according to `equals`,
+ * or, if `equals` is not overridden, if their object graphs are structurally the same.
+ *
+ * In order to specify a faster or a coarser equivalence, a public no-argument function
+ * of the sequential specification class should be marked with this annotation.
+ * It should return a value which `equals` and `hashCode` define the equivalence of the states;
+ * the function is called once per state and should not modify the instance.
+ * At most one such function is allowed.
+ */
+@Retention(RUNTIME)
+@Target(FUNCTION)
+annotation class StateFingerprint
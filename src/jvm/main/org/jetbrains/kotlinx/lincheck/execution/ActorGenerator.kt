@@ -20,7 +20,7 @@ import java.util.Random
  * using [parameter generators][ParameterGenerator].
  */
 class ActorGenerator(
-    private val method: Method,
+    val method: Method,
     private val parameterGenerators: List<ParameterGenerator<*>>,
     val useOnce: Boolean,
     cancellableOnSuspension: Boolean,
@@ -33,22 +33,49 @@ class ActorGenerator(
     private val promptCancellation = cancellableOnSuspension && promptCancellation
 
     fun generate(threadId: Int, random: Random): Actor {
-        val parameters = parameterGenerators
-            .map { it.generate() }
-            .map { if (it === THREAD_ID_TOKEN) threadId else it }
         val cancelOnSuspension = this.cancellableOnSuspension and random.nextBoolean()
         val promptCancellation = cancelOnSuspension and this.promptCancellation and random.nextBoolean()
+        return createActor(threadId, generateArguments(), cancelOnSuspension, promptCancellation)
+    }
+
+    /**
+     * Generates the actor arguments, which may contain thread id placeholders;
+     * they are substituted with the actual thread id in [createActor].
+     */
+    fun generateArguments(): List<Any?> = parameterGenerators.map { it.generate() }
+
+    /**
+     * Creates an actor executed by the thread [threadId] with the specified [arguments] produced by [generateArguments].
+     * The cancellation flags are ignored if the actor does not support them.
+     */
+    fun createActor(threadId: Int, arguments: List<Any?>, cancelOnSuspension: Boolean, promptCancellation: Boolean): Actor {
+        val cancel = cancelOnSuspension and this.cancellableOnSuspension
         return Actor(
             method = method,
-            arguments = parameters,
-            cancelOnSuspension = cancelOnSuspension,
+            arguments = arguments.map { if (it === THREAD_ID_TOKEN) threadId else it },
+            cancelOnSuspension = cancel,
             allowExtraSuspension = allowExtraSuspension,
             blocking = blocking,
             causesBlocking = causesBlocking,
-            promptCancellation = promptCancellation
+            promptCancellation = cancel and promptCancellation and this.promptCancellation
         )
     }
 
+    /**
+     * Whether the parameter [index] is the id of the thread executing the actor, see [ThreadIdGen].
+     */
+    fun isThreadIdParameter(index: Int): Boolean = parameterGenerators[index] is ThreadIdGen
+
+    /**
+     * Whether the generated actors may be cancelled on suspension.
+     */
+    val isCancellable: Boolean get() = cancellableOnSuspension
+
+    /**
+     * Whether the generated actors may be cancelled on suspension promptly.
+     */
+    val isPromptCancellable: Boolean get() = cancellableOnSuspension && promptCancellation
+
     val isSuspendable: Boolean get() = method.isSuspendable()
     override fun toString() = method.toString()
 }
\ No newline at end of file
@@ -0,0 +1,160 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+package org.jetbrains.kotlinx.lincheck.execution;
+
+import org.jetbrains.kotlinx.lincheck.Actor;
+import org.jetbrains.kotlinx.lincheck.CTestConfiguration;
+import org.jetbrains.kotlinx.lincheck.CTestStructure;
+import org.jetbrains.kotlinx.lincheck.RandomProvider;
+import org.jetbrains.kotlinx.lincheck.verifier.AbstractLTSVerifier;
+import org.jetbrains.kotlinx.lincheck.verifier.CachedVerifier;
+import org.jetbrains.kotlinx.lincheck.verifier.Verifier;
+
+import java.lang.reflect.Method;
+import java.util.*;
+
+/**
+ * This generator keeps a corpus of the <i>interesting</i> scenarios and produces new scenarios
+ * either by mutating the corpus ones or randomly, as {@link RandomExecutionGenerator} does.
+ * <p>
+ * A tested scenario is considered interesting if it has led to new behaviours,
+ * which are cheaply observed via the verifier: new transitions of the sequential specification
+ * {@link org.jetbrains.kotlinx.lincheck.verifier.LTS LTS} have been discovered,
+ * or some thread has produced results never seen before in any scenario,
+ * see {@link CachedVerifier#getObservedBehavioursCount()}.
+ * <p>
+ * The mutations change the parameters of an operation, replace it with a new one,
+ * swap two operations of different threads, or move an operation to another thread.
+ */
+public class CoverageGuidedExecutionGenerator extends RandomExecutionGenerator {
+    private static final int MAX_CORPUS_SIZE = 128;
+    private static final double MUTATION_PROBABILITY = 0.75;
+    private static final int MAX_MUTATION_ATTEMPTS = 10;
+
+    private final List<ExecutionScenario> corpus = new ArrayList<>();
+    private final Map<Method, ActorGenerator> actorGenerators = new HashMap<>();
+    private final Map<ActorGenerator, Integer> nonParallelGroups = new IdentityHashMap<>();
+
+    private long lastTransitionsCount = 0;
+    private long lastBehavioursCount = 0;
+
+    public CoverageGuidedExecutionGenerator(CTestConfiguration testConfiguration, CTestStructure testStructure, RandomProvider randomProvider) {
+        super(testConfiguration, testStructure, randomProvider);
+        for (ActorGenerator ag : testStructure.actorGenerators) {
+            actorGenerators.put(ag.getMethod(), ag);
+        }
+        List<CTestStructure.OperationGroup> groups = testStructure.operationGroups;
+        for (int i = 0; i < groups.size(); i++) {
+            if (!groups.get(i).nonParallel) continue;
+            for (ActorGenerator ag : groups.get(i).actors) {
+                nonParallelGroups.put(ag, i);
+            }
+        }
+    }
+
+    @Override
+    public ExecutionScenario nextExecution() {
+        if (!corpus.isEmpty() && random.nextDouble() < MUTATION_PROBABILITY) {
+            for (int attempt = 0; attempt < MAX_MUTATION_ATTEMPTS; attempt++) {
+                ExecutionScenario parent = corpus.get(random.nextInt(corpus.size()));
+                ExecutionScenario mutant = mutate(parent);
+                if (mutant != null && markGenerated(mutant)) return mutant;
+            }
+        }
+        return super.nextExecution();
+    }
+
+    @Override
+    public void onScenarioTested(ExecutionScenario scenario, Verifier verifier) {
+        long transitionsCount = verifier instanceof AbstractLTSVerifier ? ((AbstractLTSVerifier) verifier).getLts().getTransitionsCount() : 0;
+        long behavioursCount = verifier instanceof CachedVerifier ? ((CachedVerifier) verifier).getObservedBehavioursCount() : 0;
+        boolean isInteresting = transitionsCount > lastTransitionsCount || behavioursCount > lastBehavioursCount;
+        lastTransitionsCount = transitionsCount;
+        lastBehavioursCount = behavioursCount;
+        if (!isInteresting) return;
+        if (corpus.size() < MAX_CORPUS_SIZE) {
+            corpus.add(scenario);
+        } else {
+            corpus.set(random.nextInt(MAX_CORPUS_SIZE), scenario);
+        }
+    }
+
+    /**
+     * The number of the interesting scenarios in the corpus.
+     */
+    public int getCorpusSize() {
+        return corpus.size();
+    }
+
+    // Returns `null` if the mutation is not applicable or violates the operation restrictions.
+    private ExecutionScenario mutate(ExecutionScenario scenario) {
+        List<List<Actor>> threads = new ArrayList<>();
+        for (List<Actor> actors : scenario.getParallelExecution()) {
+            threads.add(new ArrayList<>(actors));
+        }
+        int t1 = random.nextInt(threads.size());
+        List<Actor> thread1 = threads.get(t1);
+        int i1 = random.nextInt(thread1.size());
+        int t2 = random.nextInt(threads.size());
+        List<Actor> thread2 = threads.get(t2);
+        switch (random.nextInt(4)) {
+            case 0: // change the parameters
+                thread1.set(i1, regenerate(thread1.get(i1), t1));
+                break;
+            case 1: // replace with a new operation
+                ActorGenerator ag = testStructure.actorGenerators.get(random.nextInt(testStructure.actorGenerators.size()));
+                thread1.set(i1, ag.generate(t1 + 1, random));
+                break;
+            case 2: // swap operations of different threads
+                if (t1 == t2) return null;
+                int i2 = random.nextInt(thread2.size());
+                Actor actor = thread1.get(i1);
+                thread1.set(i1, regenerate(thread2.get(i2), t1));
+                thread2.set(i2, regenerate(actor, t2));
+                break;
+            default: // move an operation to another thread
+                if (t1 == t2 || thread1.size() == 1 || thread2.size() >= testConfiguration.getActorsPerThread()) return null;
+                thread2.add(random.nextInt(thread2.size() + 1), regenerate(thread1.remove(i1), t2));
+        }
+        ExecutionScenario mutant = new ExecutionScenario(
+            scenario.getInitExecution(), threads, scenario.getPostExecution(), scenario.getValidationFunction()
+        );
+        return satisfiesRestrictions(mutant) ? mutant : null;
+    }
+
+    // Creates an actor of the same operation with new parameters for the thread `iThread`.
+    private Actor regenerate(Actor actor, int iThread) {
+        return actorGenerators.get(actor.getMethod()).generate(iThread + 1, random);
+    }
+
+    private boolean satisfiesRestrictions(ExecutionScenario scenario) {
+        if (!ExecutionScenarioKt.isValid(scenario)) return false;
+        Set<ActorGenerator> usedOnce = Collections.newSetFromMap(new IdentityHashMap<>());
+        for (Actor actor : scenario.getPostExecution()) {
+            usedOnce.add(actorGenerators.get(actor.getMethod()));
+        }
+        Map<Integer, Integer> nonParallelGroupThreads = new HashMap<>();
+        List<List<Actor>> threads = scenario.getParallelExecution();
+        for (int t = 0; t < threads.size(); t++) {
+            for (Actor actor : threads.get(t)) {
+                ActorGenerator ag = actorGenerators.get(actor.getMethod());
+                if (ag.getUseOnce() && !usedOnce.add(ag)) return false;
+                Integer group = nonParallelGroups.get(ag);
+                if (group != null) {
+                    // All the operations of a non-parallel group should be executed by the same thread.
+                    Integer groupThread = nonParallelGroupThreads.putIfAbsent(group, t);
+                    if (groupThread != null && groupThread != t) return false;
+                }
+            }
+        }
+        return true;
+    }
+}
@@ -12,6 +12,7 @@ package org.jetbrains.kotlinx.lincheck.execution;
 
 import org.jetbrains.kotlinx.lincheck.CTestConfiguration;
 import org.jetbrains.kotlinx.lincheck.CTestStructure;
+import org.jetbrains.kotlinx.lincheck.verifier.Verifier;
 
 /**
  * Implementation of this interface generates execution scenarios.
@@ -37,4 +38,18 @@ public abstract class ExecutionGenerator {
      * should not contain suspendable actors and the post part should be empty.
      */
     public abstract ExecutionScenario nextExecution();
+
+    /**
+     * Returns {@code false} if this generator has produced all the possible scenarios,
+     * so that the testing should be stopped before the specified number of iterations.
+     */
+    public boolean hasNextExecution() {
+        return true;
+    }
+
+    /**
+     * Is called after the scenario produced by {@link #nextExecution()} has been tested without failures;
+     * the generators may use the state of the {@code verifier} as a feedback for producing the next scenarios.
+     */
+    public void onScenarioTested(ExecutionScenario scenario, Verifier verifier) {}
 }
@@ -0,0 +1,92 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.execution
+
+import org.jetbrains.kotlinx.lincheck.*
+
+/**
+ * A 64-bit fingerprint of the execution results and their clocks;
+ * the state representations are ignored, as in [ExecutionResult.equals].
+ *
+ * Equal results always have equal fingerprints, while different results
+ * may collide, as the result values contribute only their 32-bit `hashCode()`;
+ * thus, a fingerprint match should always be confirmed via `equals`.
+ *
+ * The results are fed into the fingerprint in the canonical order:
+ * the init part, each thread of the parallel part (each result followed by its clock),
+ * and the post part, every part prefixed by its size. Any other representation
+ * of the results (e.g., the runner's result buffer) must use the same order
+ * via [fingerprintStep] and [fingerprintFinish] to produce compatible fingerprints.
+ */
+val ExecutionResult.fingerprint: Long get() {
+    var h = FINGERPRINT_SEED
+    h = fingerprintResults(h, initResults)
+    h = fingerprintStep(h, parallelResultsWithClock.size)
+    for (threadResults in parallelResultsWithClock) {
+        h = fingerprintStep(h, threadResults.size)
+        for (resultWithClock in threadResults) {
+            h = fingerprintStep(h, resultWithClock.result)
+            for (c in resultWithClock.clockOnStart.clock) h = fingerprintStep(h, c)
+        }
+    }
+    h = fingerprintResults(h, postResults)
+    return fingerprintFinish(h)
+}
+
+/**
+ * Scenario-independent fingerprints of the behaviours observed in the [results] of the [scenario]:
+ * one for the operations with their results in each thread of the parallel part,
+ * and one for the init and post parts together.
+ * Unlike [fingerprint], they depend neither on the other threads nor on the clocks,
+ * so the same behaviour of a thread is recognized in different scenarios.
+ */
+internal fun behaviourFingerprints(scenario: ExecutionScenario, results: ExecutionResult): LongArray {
+    val fingerprints = LongArray(scenario.nThreads + 1)
+    for (t in 0 until scenario.nThreads) {
+        var h = FINGERPRINT_SEED
+        val threadResults = results.parallelResultsWithClock[t]
+        scenario.parallelExecution[t].forEachIndexed { i, actor ->
+            h = fingerprintStep(fingerprintStep(h, actor.hashCode()), threadResults[i].result)
+        }
+        fingerprints[t] = fingerprintFinish(h)
+    }
+    var h = fingerprintStep(FINGERPRINT_SEED, -1) // differs from the threads with the same operations
+    scenario.initExecution.forEachIndexed { i, actor ->
+        h = fingerprintStep(fingerprintStep(h, actor.hashCode()), results.initResults[i])
+    }
+    h = fingerprintStep(h, scenario.initExecution.size)
+    scenario.postExecution.forEachIndexed { i, actor ->
+        h = fingerprintStep(fingerprintStep(h, actor.hashCode()), results.postResults[i])
+    }
+    fingerprints[scenario.nThreads] = fingerprintFinish(h)
+    return fingerprints
+}
+
+private fun fingerprintResults(hash: Long, results: List<Result?>): Long {
+    var h = fingerprintStep(hash, results.size)
+    for (r in results) h = fingerprintStep(h, r)
+    return h
+}
+
+internal const val FINGERPRINT_SEED = -0x340d631b7bdddcdbL // FNV-1a 64-bit offset basis
+
+internal fun fingerprintStep(hash: Long, result: Result?): Long =
+    fingerprintStep(hash, result?.hashCode() ?: 0)
+
+internal fun fingerprintStep(hash: Long, value: Int): Long =
+    (hash xor value.toLong()) * 0x100000001b3L // FNV-1a 64-bit prime
+
+// The MurmurHash3 finalizer, spreads the FNV state over all 64 bits.
+internal fun fingerprintFinish(hash: Long): Long {
+    var h = hash
+    h = (h xor (h ushr 33)) * -0xae502812aa7333L
+    h = (h xor (h ushr 33)) * -0x3b314601e57a13adL
+    return h xor (h ushr 33)
+}
@@ -0,0 +1,300 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+package org.jetbrains.kotlinx.lincheck.execution;
+
+import org.jetbrains.kotlinx.lincheck.Actor;
+import org.jetbrains.kotlinx.lincheck.CTestConfiguration;
+import org.jetbrains.kotlinx.lincheck.CTestStructure;
+import org.jetbrains.kotlinx.lincheck.RandomProvider;
+
+import java.util.*;
+
+/**
+ * This generator systematically enumerates all the scenarios within the bounds of the test configuration:
+ * from two to {@link CTestConfiguration#getThreads() threads} parallel threads, each executing from one to
+ * {@link CTestConfiguration#getActorsPerThread() actorsPerThread} operations, and up to
+ * {@link CTestConfiguration#getActorsBefore() actorsBefore} and {@link CTestConfiguration#getActorsAfter() actorsAfter}
+ * operations in the init and post parts. Once all the scenarios are tested without failures,
+ * there is no bug within these bounds (up to the strategy completeness), so that
+ * the number of iterations should be large enough to cover all of them.
+ * <p>
+ * The scenarios are enumerated in the order of their total size, so that all the smaller scenarios
+ * are tested before the larger ones even if the number of iterations is not sufficient to cover all of them;
+ * among the scenarios of the same shape, the parallel part changes first.
+ * The parallel threads are symmetric, so the scenarios which differ only in the order of threads
+ * are enumerated only once. The parameters of each operation are taken from a small domain
+ * of {@link #ARGUMENTS_PER_OPERATION} distinct values produced by its parameter generators;
+ * the operations that can be cancelled on suspension are enumerated with and without cancellation,
+ * including the prompt one if it is allowed.
+ * The operation sequences are enumerated lazily, so that the memory usage does not depend on the bounds.
+ * <p>
+ * This generator can be used with any strategy; with the model checking, each enumerated scenario
+ * is explored within the {@code invocationsPerIteration} budget.
+ */
+public class ExhaustiveExecutionGenerator extends ExecutionGenerator {
+    /**
+     * The maximal number of distinct argument lists of each operation.
+     */
+    public static final int ARGUMENTS_PER_OPERATION =
+        Integer.getInteger("lincheck.exhaustiveGenerator.argumentsPerOperation", 2);
+
+    // The operations that can be executed in the parallel part.
+    private final List<Operation> parallelOperations = new ArrayList<>();
+    // The operations that can be executed in the init and post parts.
+    private final List<Operation> sequentialOperations = new ArrayList<>();
+
+    // The indices of the non-parallel groups the actor generators belong to.
+    private final Map<ActorGenerator, Integer> nonParallelGroups = new IdentityHashMap<>();
+
+    private final int minThreads;
+    private final int maxSize;
+
+    // The total size of the current scenario, and all the scenario shapes of this size.
+    private int size = 0;
+    private List<Shape> shapes = Collections.emptyList();
+    private int shapeIndex = 0;
+
+    // The current scenario: its shape, the operation sequences (words) of the threads, which are
+    // lexicographically non-decreasing for the threads of the same length, and the init and post part words.
+    private Shape shape;
+    private int[][] threadWords;
+    private int[] initWord;
+    private int[] postWord;
+    private boolean exhausted;
+    private ExecutionScenario next;
+
+    public ExhaustiveExecutionGenerator(CTestConfiguration testConfiguration, CTestStructure testStructure, RandomProvider randomProvider) {
+        super(testConfiguration, testStructure);
+        for (ActorGenerator ag : testStructure.actorGenerators) {
+            List<Operation> operations = operationDomain(ag);
+            parallelOperations.addAll(operations);
+            if (!ag.getUseOnce() && !ag.isSuspendable()) {
+                sequentialOperations.addAll(operations);
+            }
+        }
+        List<CTestStructure.OperationGroup> groups = testStructure.operationGroups;
+        for (int i = 0; i < groups.size(); i++) {
+            if (!groups.get(i).nonParallel) continue;
+            for (ActorGenerator ag : groups.get(i).actors) {
+                nonParallelGroups.put(ag, i);
+            }
+        }
+        minThreads = Math.min(2, testConfiguration.getThreads());
+        maxSize = testConfiguration.getThreads() * testConfiguration.getActorsPerThread() +
+            testConfiguration.getActorsBefore() + testConfiguration.getActorsAfter();
+        exhausted = minThreads == 0 || parallelOperations.isEmpty();
+        if (!exhausted) nextShape();
+    }
+
+    /**
+     * Returns {@code true} if all the scenarios within the bounds have been generated.
+     */
+    public boolean isExhausted() {
+        return !hasNextExecution();
+    }
+
+    @Override
+    public boolean hasNextExecution() {
+        while (next == null && !exhausted) {
+            next = createScenarioIfValid();
+            advance();
+        }
+        return next != null;
+    }
+
+    @Override
+    public ExecutionScenario nextExecution() {
+        if (!hasNextExecution()) {
+            throw new NoSuchElementException("All the scenarios within the bounds have been generated");
+        }
+        ExecutionScenario scenario = next;
+        next = null;
+        return scenario;
+    }
+
+    private List<Operation> operationDomain(ActorGenerator ag) {
+        Set<List<Object>> argumentLists = new LinkedHashSet<>();
+        for (int attempt = 0; attempt < 10 * ARGUMENTS_PER_OPERATION && argumentLists.size() < ARGUMENTS_PER_OPERATION; attempt++) {
+            argumentLists.add(ag.generateArguments());
+        }
+        List<Operation> operations = new ArrayList<>();
+        for (List<Object> arguments : argumentLists) {
+            operations.add(new Operation(ag, arguments, false, false));
+            if (ag.isCancellable()) {
+                operations.add(new Operation(ag, arguments, true, false));
+            }
+            if (ag.isPromptCancellable()) {
+                operations.add(new Operation(ag, arguments, true, true));
+            }
+        }
+        return operations;
+    }
+
+    // Moves to the next combination: the multiset of thread words changes first, then the init
+    // and post part words, then the scenario shape, and finally the total scenario size.
+    private void advance() {
+        if (nextThreadWords()) return;
+        if (nextWord(initWord, sequentialOperations.size())) return;
+        if (nextWord(postWord, sequentialOperations.size())) return;
+        shapeIndex++;
+        nextShape();
+    }
+
+    // The words of the threads with the same length are non-decreasing, which eliminates the thread permutations;
+    // the threads of different lengths are ordered by length in the shape, so they cannot be permuted.
+    // Returns `false` and resets the words to the first combination if the current one is the last.
+    private boolean nextThreadWords() {
+        for (int t = threadWords.length - 1; t >= 0; t--) {
+            if (nextWord(threadWords[t], parallelOperations.size())) {
+                for (int u = t + 1; u < threadWords.length; u++) {
+                    if (shape.threadLengths[u] == shape.threadLengths[t]) {
+                        System.arraycopy(threadWords[t], 0, threadWords[u], 0, threadWords[t].length);
+                    } else {
+                        Arrays.fill(threadWords[u], 0);
+                    }
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Moves the sequence of `[0, alphabetSize)` elements to the next one in the lexicographic order;
+    // returns `false` and resets it to the first sequence if the current one is the last.
+    private static boolean nextWord(int[] word, int alphabetSize) {
+        for (int i = word.length - 1; i >= 0; i--) {
+            if (++word[i] < alphabetSize) return true;
+            word[i] = 0;
+        }
+        return false;
+    }
+
+    // Moves to the shape at `shapeIndex`, or to the first shape of the next non-empty size.
+    private void nextShape() {
+        while (shapeIndex >= shapes.size()) {
+            if (++size > maxSize) {
+                exhausted = true;
+                return;
+            }
+            shapes = shapes(size);
+            shapeIndex = 0;
+        }
+        shape = shapes.get(shapeIndex);
+        threadWords = new int[shape.threadLengths.length][];
+        for (int t = 0; t < threadWords.length; t++) {
+            threadWords[t] = new int[shape.threadLengths[t]];
+        }
+        initWord = new int[shape.initLength];
+        postWord = new int[shape.postLength];
+    }
+
+    // All the shapes of the scenarios of the specified total size: fewer threads first,
+    // and then the shapes with more operations in the parallel part.
+    private List<Shape> shapes(int size) {
+        List<Shape> shapes = new ArrayList<>();
+        for (int nThreads = minThreads; nThreads <= testConfiguration.getThreads(); nThreads++) {
+            for (int sequentialSize = 0; sequentialSize <= size - nThreads; sequentialSize++) {
+                for (int initLength = 0; initLength <= sequentialSize; initLength++) {
+                    int postLength = sequentialSize - initLength;
+                    if (postLength > testConfiguration.getActorsAfter() || initLength > testConfiguration.getActorsBefore()) continue;
+                    if (sequentialSize > 0 && sequentialOperations.isEmpty()) continue;
+                    addThreadLengths(shapes, initLength, postLength, new int[nThreads], 0, 1, size - sequentialSize);
+                }
+            }
+        }
+        return shapes;
+    }
+
+    // Adds the shapes with all the non-decreasing `threadLengths` starting from `t`-th thread,
+    // which are at least `minLength` and sum up to `parallelSize`.
+    private void addThreadLengths(List<Shape> shapes, int initLength, int postLength,
+                                  int[] threadLengths, int t, int minLength, int parallelSize) {
+        if (t == threadLengths.length) {
+            if (parallelSize == 0) shapes.add(new Shape(initLength, postLength, threadLengths.clone()));
+            return;
+        }
+        int threadsLeft = threadLengths.length - t;
+        for (int length = minLength; length <= testConfiguration.getActorsPerThread() && length * threadsLeft <= parallelSize; length++) {
+            threadLengths[t] = length;
+            addThreadLengths(shapes, initLength, postLength, threadLengths, t + 1, length, parallelSize - length);
+        }
+    }
+
+    // Returns `null` if the current combination violates the operation restrictions.
+    private ExecutionScenario createScenarioIfValid() {
+        Set<ActorGenerator> usedOnce = Collections.newSetFromMap(new IdentityHashMap<>());
+        Map<Integer, Integer> nonParallelGroupThreads = new HashMap<>();
+        boolean hasSuspendableActors = false;
+        List<List<Actor>> parallelExecution = new ArrayList<>();
+        for (int t = 0; t < threadWords.length; t++) {
+            List<Actor> actors = new ArrayList<>();
+            for (int op : threadWords[t]) {
+                Operation operation = parallelOperations.get(op);
+                ActorGenerator ag = operation.generator;
+                if (ag.getUseOnce() && !usedOnce.add(ag)) return null;
+                Integer group = nonParallelGroups.get(ag);
+                if (group != null) {
+                    // All the operations of a non-parallel group should be executed by the same thread.
+                    Integer groupThread = nonParallelGroupThreads.putIfAbsent(group, t);
+                    if (groupThread != null && groupThread != t) return null;
+                }
+                hasSuspendableActors |= ag.isSuspendable();
+                actors.add(operation.createActor(t + 1));
+            }
+            parallelExecution.add(actors);
+        }
+        // Suspended operations could be resumed by the post part, so it should be empty.
+        if (hasSuspendableActors && postWord.length > 0) return null;
+        // The thread ids are the same as in RandomExecutionGenerator.
+        List<Actor> initExecution = sequentialActors(initWord, 0);
+        List<Actor> postExecution = sequentialActors(postWord, testConfiguration.getThreads() + 1);
+        return new ExecutionScenario(initExecution, parallelExecution, postExecution, testStructure.validationFunction);
+    }
+
+    private List<Actor> sequentialActors(int[] word, int threadId) {
+        List<Actor> actors = new ArrayList<>(word.length);
+        for (int op : word) {
+            actors.add(sequentialOperations.get(op).createActor(threadId));
+        }
+        return actors;
+    }
+
+    // The lengths of the scenario parts; the thread lengths are non-decreasing.
+    private static class Shape {
+        final int initLength;
+        final int postLength;
+        final int[] threadLengths;
+
+        Shape(int initLength, int postLength, int[] threadLengths) {
+            this.initLength = initLength;
+            this.postLength = postLength;
+            this.threadLengths = threadLengths;
+        }
+    }
+
+    private static class Operation {
+        final ActorGenerator generator;
+        final List<Object> arguments;
+        final boolean cancelOnSuspension;
+        final boolean promptCancellation;
+
+        Operation(ActorGenerator generator, List<Object> arguments, boolean cancelOnSuspension, boolean promptCancellation) {
+            this.generator = generator;
+            this.arguments = arguments;
+            this.cancelOnSuspension = cancelOnSuspension;
+            this.promptCancellation = promptCancellation;
+        }
+
+        Actor createActor(int threadId) {
+            return generator.createActor(threadId, arguments, cancelOnSuspension, promptCancellation);
+        }
+    }
+}
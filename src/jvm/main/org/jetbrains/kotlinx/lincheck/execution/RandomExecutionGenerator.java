@@ -15,26 +15,130 @@ import org.jetbrains.kotlinx.lincheck.CTestConfiguration;
 import org.jetbrains.kotlinx.lincheck.CTestStructure;
 import org.jetbrains.kotlinx.lincheck.RandomProvider;
 
+import java.lang.reflect.Method;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
 import java.util.Iterator;
 import java.util.List;
+import java.util.Map;
 import java.util.Random;
+import java.util.Set;
 import java.util.stream.Collectors;
 
 public class RandomExecutionGenerator extends ExecutionGenerator {
-    private final Random random;
+    /**
+     * The maximal number of attempts to generate a scenario
+     * that is not equivalent to any of the previously generated ones.
+     */
+    private static final int MAX_RESAMPLING_ATTEMPTS = 10;
+
+    /**
+     * The maximal number of remembered canonical forms of the generated scenarios;
+     * the scenarios generated after that are compared with the remembered ones only.
+     */
+    private static final int MAX_REMEMBERED_SCENARIOS = 1 << 16;
+
+    /**
+     * Whether the scenarios equivalent to the previously generated ones are re-sampled.
+     * The scenario sequence is deterministic for a fixed seed in both modes, but re-sampling
+     * consumes additional random choices, so the sequence differs from the one generated
+     * without re-sampling; disable it to reproduce the latter.
+     */
+    private static final boolean SKIP_EQUIVALENT_SCENARIOS =
+        Boolean.parseBoolean(System.getProperty("lincheck.randomGenerator.skipEquivalentScenarios", "true"));
+
+    // Replaces the thread id arguments in the canonical forms, see `actorForm(..)`.
+    private static final Object THREAD_ID_PLACEHOLDER = new Object();
+
+    protected final Random random;
+
+    // The operation lists below do not depend on the generated scenario, so they are computed once.
+    private final List<ActorGenerator> validActorGeneratorsForInit;
+    private final List<CTestStructure.OperationGroup> nonParallelGroups;
+    private final List<ActorGenerator> parallelActorGenerators;
+
+    // Used to find the thread id parameters of the actors, see `actorForm(..)`.
+    private final Map<Method, ActorGenerator> actorGeneratorsByMethod = new HashMap<>();
+    // Canonical forms of the generated scenarios, see `canonicalForm(..)`.
+    private final Set<List<Object>> generatedScenarios = new HashSet<>();
 
     public RandomExecutionGenerator(CTestConfiguration testConfiguration, CTestStructure testStructure, RandomProvider randomProvider) {
         super(testConfiguration, testStructure);
         random = randomProvider.createRandom();
+        validActorGeneratorsForInit = testStructure.actorGenerators.stream()
+            .filter(ag -> !ag.getUseOnce() && !ag.isSuspendable()).collect(Collectors.toList());
+        nonParallelGroups = testStructure.operationGroups.stream()
+            .filter(g -> g.nonParallel)
+            .collect(Collectors.toList());
+        parallelActorGenerators = new ArrayList<>(testStructure.actorGenerators);
+        nonParallelGroups.forEach(g -> parallelActorGenerators.removeAll(g.actors));
+        testStructure.actorGenerators.forEach(ag -> actorGeneratorsByMethod.put(ag.getMethod(), ag));
     }
 
+    /**
+     * Generates a random scenario, re-sampling it a bounded number of times
+     * if an equivalent scenario has already been generated, so that
+     * the iterations are not wasted on re-testing the same scenarios.
+     */
     @Override
     public ExecutionScenario nextExecution() {
+        ExecutionScenario scenario;
+        int attempts = 0;
+        do {
+            scenario = generateScenario();
+        } while (SKIP_EQUIVALENT_SCENARIOS && !markGenerated(scenario) && ++attempts < MAX_RESAMPLING_ATTEMPTS);
+        return scenario;
+    }
+
+    /**
+     * Remembers the specified scenario as generated;
+     * returns {@code false} if an equivalent scenario has already been generated.
+     */
+    protected boolean markGenerated(ExecutionScenario scenario) {
+        List<Object> form = canonicalForm(scenario);
+        if (generatedScenarios.size() >= MAX_REMEMBERED_SCENARIOS) return !generatedScenarios.contains(form);
+        return generatedScenarios.add(form);
+    }
+
+    /**
+     * Scenarios that differ only in the order of the parallel threads are equivalent,
+     * so the canonical form of a scenario consists of the init part, the multiset
+     * of the parallel threads, and the post part.
+     */
+    private List<Object> canonicalForm(ExecutionScenario scenario) {
+        Map<List<List<Object>>, Integer> threads = new HashMap<>();
+        for (List<Actor> actors : scenario.getParallelExecution()) {
+            threads.merge(actorForms(actors), 1, Integer::sum);
+        }
+        return Arrays.asList(actorForms(scenario.getInitExecution()), threads, actorForms(scenario.getPostExecution()));
+    }
+
+    private List<List<Object>> actorForms(List<Actor> actors) {
+        List<List<Object>> forms = new ArrayList<>(actors.size());
+        for (Actor actor : actors) {
+            forms.add(actorForm(actor));
+        }
+        return forms;
+    }
+
+    /**
+     * The thread id arguments are replaced with a placeholder: the same actors
+     * executed by swapped threads receive the ids of these threads.
+     */
+    private List<Object> actorForm(Actor actor) {
+        ActorGenerator generator = actorGeneratorsByMethod.get(actor.getMethod());
+        List<Object> arguments = new ArrayList<>(actor.getArguments());
+        for (int i = 0; i < arguments.size(); i++) {
+            if (generator != null && generator.isThreadIdParameter(i)) arguments.set(i, THREAD_ID_PLACEHOLDER);
+        }
+        return Arrays.asList(actor.getMethod(), arguments, actor.getCancelOnSuspension(), actor.getPromptCancellation());
+    }
+
+    private ExecutionScenario generateScenario() {
         // Create init execution part
-        List<ActorGenerator> validActorGeneratorsForInit = testStructure.actorGenerators.stream()
-            .filter(ag -> !ag.getUseOnce() && !ag.isSuspendable()).collect(Collectors.toList());
         List<Actor> initExecution = new ArrayList<>();
         for (int i = 0; i < testConfiguration.getActorsBefore() && !validActorGeneratorsForInit.isEmpty(); i++) {
             ActorGenerator ag = validActorGeneratorsForInit.get(random.nextInt(validActorGeneratorsForInit.size()));
@@ -42,12 +146,9 @@ public class RandomExecutionGenerator extends ExecutionGenerator {
         }
         // Create parallel execution part
         // Construct non-parallel groups and parallel one
-        List<CTestStructure.OperationGroup> nonParallelGroups = testStructure.operationGroups.stream()
-            .filter(g -> g.nonParallel)
-            .collect(Collectors.toList());
+        List<CTestStructure.OperationGroup> nonParallelGroups = new ArrayList<>(this.nonParallelGroups);
         Collections.shuffle(nonParallelGroups, random);
-        List<ActorGenerator> parallelGroup = new ArrayList<>(testStructure.actorGenerators);
-        nonParallelGroups.forEach(g -> parallelGroup.removeAll(g.actors));
+        List<ActorGenerator> parallelGroup = new ArrayList<>(parallelActorGenerators);
 
         List<List<Actor>> parallelExecution = new ArrayList<>();
         List<ThreadGen> threadGens = new ArrayList<>();
@@ -81,7 +182,7 @@ public class RandomExecutionGenerator extends ExecutionGenerator {
                     it.remove();
             }
         }
-        parallelExecution = parallelExecution.stream().filter(actors -> !actors.isEmpty()).collect(Collectors.toList());
+        parallelExecution.removeIf(List::isEmpty);
         // Create post execution part if the parallel part does not have suspendable actors
         List<Actor> postExecution;
         if (parallelExecution.stream().noneMatch(actors -> actors.stream().anyMatch(Actor::isSuspendable))) {
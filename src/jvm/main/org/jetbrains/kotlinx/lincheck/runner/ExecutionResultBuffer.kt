@@ -0,0 +1,139 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.runner
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.verifier.*
+
+/**
+ * A view over the preallocated `results` and `clocks` arrays
+ * of the [TestThreadExecution]-s of a [ParallelThreadsRunner].
+ *
+ * The runner re-uses the same arrays in all invocations, so this buffer
+ * allows to fingerprint and compare the results of the last invocation without
+ * allocating an [ExecutionResult]; the latter is [materialized][materialize]
+ * only when required (e.g., when the results have not been verified yet,
+ * or a failure should be reported).
+ *
+ * The buffer content is valid until the next [ParallelThreadsRunner.run] call;
+ * each completed invocation gets a new [invocation] number, so that
+ * a [CompletedInvocationResult] can detect that its results have been overwritten.
+ */
+internal class ExecutionResultBuffer(
+    private val initialPartExecution: TestThreadExecution?,
+    private val parallelPartExecutions: Array<TestThreadExecution>,
+    private val postPartExecution: TestThreadExecution?
+) : ResultFingerprintSet.ResultMatcher {
+    private var afterInitStateRepresentation: String? = null
+    private var afterParallelStateRepresentation: String? = null
+    private var afterPostStateRepresentation: String? = null
+
+    private var materializedResult: ExecutionResult? = null
+
+    /**
+     * The number of the buffer modifications, which identifies the buffered results.
+     */
+    var invocation = 0L
+        private set
+
+    /**
+     * Should be called by the runner when a new invocation completes.
+     */
+    fun onInvocationCompleted(
+        afterInitStateRepresentation: String?,
+        afterParallelStateRepresentation: String?,
+        afterPostStateRepresentation: String?
+    ) {
+        this.afterInitStateRepresentation = afterInitStateRepresentation
+        this.afterParallelStateRepresentation = afterParallelStateRepresentation
+        this.afterPostStateRepresentation = afterPostStateRepresentation
+        invalidate()
+    }
+
+    /**
+     * Should be called by the runner before the buffered arrays are modified.
+     */
+    fun invalidate() {
+        materializedResult = null
+        invocation++
+    }
+
+    /**
+     * Returns the [ExecutionResult] of the last invocation, creating it on the first call.
+     */
+    fun materialize(): ExecutionResult = materializedResult ?: ExecutionResult(
+        initResults = initialPartExecution?.results?.toList().orEmpty(),
+        parallelResultsWithClock = parallelPartExecutions.map { execution ->
+            // The unused clocks are all zeros, so they can share the same immutable instance.
+            val emptyClock = if (execution.useClocks) null else emptyClock(parallelPartExecutions.size)
+            execution.results.zip(execution.clocks).map {
+                ResultWithClock(it.first, emptyClock ?: HBClock(it.second.clone()))
+            }
+        },
+        postResults = postPartExecution?.results?.toList().orEmpty(),
+        afterInitStateRepresentation = afterInitStateRepresentation,
+        afterParallelStateRepresentation = afterParallelStateRepresentation,
+        afterPostStateRepresentation = afterPostStateRepresentation
+    ).also { materializedResult = it }
+
+    /**
+     * Computes the [fingerprint][ExecutionResult.fingerprint] of the buffered results and clocks.
+     */
+    fun fingerprint(): Long {
+        var h = FINGERPRINT_SEED
+        h = fingerprintResults(h, initialPartExecution?.results)
+        h = fingerprintStep(h, parallelPartExecutions.size)
+        for (execution in parallelPartExecutions) {
+            h = fingerprintStep(h, execution.results.size)
+            for (i in execution.results.indices) {
+                h = fingerprintStep(h, execution.results[i])
+                for (c in execution.clocks[i]) h = fingerprintStep(h, c)
+            }
+        }
+        h = fingerprintResults(h, postPartExecution?.results)
+        return fingerprintFinish(h)
+    }
+
+    /**
+     * Checks whether the buffered results and clocks are equal to the specified [result],
+     * ignoring the state representations.
+     */
+    override fun matches(result: ExecutionResult): Boolean {
+        if (!resultsEqual(initialPartExecution?.results, result.initResults)) return false
+        if (parallelPartExecutions.size != result.parallelResultsWithClock.size) return false
+        for (t in parallelPartExecutions.indices) {
+            val execution = parallelPartExecutions[t]
+            val expected = result.parallelResultsWithClock[t]
+            if (execution.results.size != expected.size) return false
+            for (i in expected.indices) {
+                if (execution.results[i] != expected[i].result) return false
+                if (!execution.clocks[i].contentEquals(expected[i].clockOnStart.clock)) return false
+            }
+        }
+        return resultsEqual(postPartExecution?.results, result.postResults)
+    }
+
+    private fun fingerprintResults(hash: Long, results: Array<Result?>?): Long {
+        if (results == null) return fingerprintStep(hash, 0)
+        var h = fingerprintStep(hash, results.size)
+        for (r in results) h = fingerprintStep(h, r)
+        return h
+    }
+
+    private fun resultsEqual(actual: Array<Result?>?, expected: List<Result?>): Boolean {
+        if (actual == null) return expected.isEmpty()
+        if (actual.size != expected.size) return false
+        for (i in actual.indices) {
+            if (actual[i] != expected[i]) return false
+        }
+        return true
+    }
+}
@@ -27,7 +27,7 @@ import java.util.concurrent.locks.*
  */
 internal class FixedActiveThreadsExecutor(private val testName: String, private val nThreads: Int) : Closeable {
     /**
-     * null, waiting TestThread, Runnable task, or SHUTDOWN
+     * null, waiting TestThread, Runnable task (usually, [TestThreadExecution]), or SHUTDOWN
      */
     private val tasks = atomicArrayOfNulls<Any>(nThreads)
 
@@ -58,21 +58,24 @@ internal class FixedActiveThreadsExecutor(private val testName: String, private
     /**
      * This flag is set to `true` when [await] detects a hang.
      * In this case, when this executor is closed, [Thread.stop]
-     * is called on all the internal threads.
+     * is called on all the internal threads, and they are not returned to [TestThreadPool].
      */
     private var hangDetected = false
 
     /**
-     * Threads used in this runner.
+     * Threads used in this runner, they are taken from [TestThreadPool]
+     * and are returned there when this executor is closed.
      */
     val threads = Array(nThreads) { iThread ->
-        TestThread(
-            testName = testName,
-            threadId = iThread,
-            block = testThreadRunnable(iThread)
-        ).also { it.start() }
+        TestThreadPool.start(testName, iThread, testThreadJob(iThread))
     }
 
+    /**
+     * If set, the hangs of the test threads are detected as soon as possible, without waiting
+     * for the whole timeout; in this case, [TimeoutException] is thrown as well.
+     */
+    var hangWatchdog: HangWatchdog? = null
+
     /**
      * Submits the specified set of [tasks] to this executor
      * and waits until all of them are completed.
@@ -97,6 +100,18 @@ internal class FixedActiveThreadsExecutor(private val testName: String, private
         return await(tasks, timeoutNano)
     }
 
+    /**
+     * Submits the specified [tasks] to this executor, so that `tasks[i]` is executed by the `i`-th thread,
+     * and waits until all of them are completed; see the [TestThreadExecution]-based overload for details.
+     */
+    fun submitAndAwaitPerThread(tasks: Array<out Runnable>, timeoutNano: Long): Long {
+        require(tasks.size <= nThreads) {
+            "Submitted tasks contain thread index outside of current executor bounds."
+        }
+        tasks.forEachIndexed { iThread, task -> submitTask(iThread, task) }
+        return await(tasks.size, { it }, timeoutNano)
+    }
+
     private fun submitTasks(tasks: Array<out TestThreadExecution>) {
         for (task in tasks) {
             val i = task.iThread
@@ -118,12 +133,16 @@ internal class FixedActiveThreadsExecutor(private val testName: String, private
         }
     }
 
-    private fun await(tasks: Array<out TestThreadExecution>, timeoutNano: Long): Long {
+    private fun await(tasks: Array<out TestThreadExecution>, timeoutNano: Long): Long =
+        await(tasks.size, { tasks[it].iThread }, timeoutNano)
+
+    private inline fun await(nTasks: Int, threadOfTask: (Int) -> Int, timeoutNano: Long): Long {
         val startTime = System.nanoTime()
         val deadline = startTime + timeoutNano
+        hangWatchdog?.reset()
         var exception: Throwable? = null
-        for (task in tasks) {
-            val e = awaitTask(task.iThread, deadline)
+        for (i in 0 until nTasks) {
+            val e = awaitTask(threadOfTask(i), deadline)
             if (e != null) {
                 if (exception == null) {
                     exception = e
@@ -149,27 +168,33 @@ internal class FixedActiveThreadsExecutor(private val testName: String, private
         // Park with timeout until the result is set or the timeout is passed.
         val currentThread = Thread.currentThread()
         if (results[iThread].compareAndSet(null, currentThread)) {
+            val watchdog = hangWatchdog
             while (results[iThread].value === currentThread) {
                 val timeLeft = deadline - System.nanoTime()
-                if (timeLeft <= 0) {
+                if (timeLeft <= 0 || watchdog != null && watchdog.isHung(::isRunning)) {
                     hangDetected = true
                     throw TimeoutException()
                 }
-                LockSupport.parkNanos(timeLeft)
+                LockSupport.parkNanos(if (watchdog == null) timeLeft else minOf(timeLeft, HangWatchdog.CHECK_PERIOD_MS * 1_000_000))
             }
         }
         return results[iThread].value!!
     }
 
-    private fun testThreadRunnable(iThread: Int) = Runnable {
+    // Returns whether the thread can be re-used by other executors.
+    // Whether the thread is still executing the submitted task.
+    private fun isRunning(iThread: Int): Boolean = results[iThread].value.let { it == null || it is Thread }
+
+    private fun testThreadJob(iThread: Int): () -> Boolean = job@{
         loop@ while (true) {
             val task = runInIgnoredSection {
                 val task = getTask(iThread)
-                if (task === Shutdown) return@Runnable
+                // The threads which could hang should not be re-used.
+                if (task === Shutdown) return@job !hangDetected
                 tasks[iThread].value = null // reset task
-                task as TestThreadExecution
+                task as Runnable
             }
-            check(task.iThread == iThread)
+            check(task !is TestThreadExecution || task.iThread == iThread)
             try {
                 task.run()
             } catch(e: Throwable) {
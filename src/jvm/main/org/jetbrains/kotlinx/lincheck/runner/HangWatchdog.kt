@@ -0,0 +1,84 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.runner
+
+import java.lang.Thread.State.*
+import java.lang.management.*
+
+/**
+ * Detects hangs of the test [threads] without waiting for the whole invocation timeout.
+ * It is periodically [checked][isHung] by the thread waiting for the test threads, and reports a hang when
+ * - some of the running test threads are deadlocked according to [ThreadMXBean.findDeadlockedThreads], or
+ * - the stall detection is enabled via [stallTimeMs], and the [progress] counter, which should grow
+ *   on each actor completion, has not changed for [stallTimeMs], while all the running test threads
+ *   are [BLOCKED] or [WAITING] without a timeout.
+ *
+ * The stall detection is disabled by default: a correct test may legitimately wait
+ * for longer than any fixed period, e.g., for a thread outside the test, see [stallTimeMsProperty].
+ */
+internal class HangWatchdog(
+    private val threads: Array<out Thread>,
+    private val stallTimeMs: Long? = stallTimeMsProperty(),
+    private val progress: () -> Long
+) {
+    @Suppress("DEPRECATION")
+    private val threadIds = LongArray(threads.size) { threads[it].id }
+
+    private var lastProgress = 0L
+    private var stalledSince = 0L
+    private var lastCheckTime = 0L
+
+    /**
+     * Should be called before waiting for the next tasks.
+     */
+    fun reset() {
+        lastProgress = progress()
+        stalledSince = System.nanoTime()
+        lastCheckTime = 0L
+    }
+
+    /**
+     * Checks whether the test threads for which [isRunning] returns `true` hang.
+     * The actual checks are performed at most once per [CHECK_PERIOD_MS].
+     */
+    fun isHung(isRunning: (iThread: Int) -> Boolean): Boolean {
+        val now = System.nanoTime()
+        if (now - lastCheckTime < CHECK_PERIOD_MS * 1_000_000) return false
+        lastCheckTime = now
+        val deadlocked = threadMXBean.findDeadlockedThreads()
+        if (deadlocked != null && threads.indices.any { isRunning(it) && threadIds[it] in deadlocked }) return true
+        if (stallTimeMs == null) return false
+        val currentProgress = progress()
+        val blocked = threads.indices.all { !isRunning(it) || threads[it].state.let { s -> s == BLOCKED || s == WAITING } }
+        if (currentProgress != lastProgress || !blocked) {
+            lastProgress = currentProgress
+            stalledSince = now
+            return false
+        }
+        return now - stalledSince >= stallTimeMs * 1_000_000
+    }
+
+    companion object {
+        /**
+         * The period of the checks, the thread waiting for the test threads
+         * should not sleep longer than this period between the [isHung] calls.
+         */
+        const val CHECK_PERIOD_MS = 10L
+    }
+}
+
+private val threadMXBean: ThreadMXBean = ManagementFactory.getThreadMXBean()
+
+/**
+ * Returns the stall detection period specified via the `lincheck.hangDetection.stallTimeMs`
+ * system property, or `null` if it is not set to a positive number, so that stalls are not detected.
+ */
+internal fun stallTimeMsProperty(): Long? =
+    System.getProperty("lincheck.hangDetection.stallTimeMs")?.toLongOrNull()?.takeIf { it > 0 }
@@ -19,10 +19,38 @@ sealed class InvocationResult
 
 /**
  * The invocation completed successfully, the output [results] are provided.
+ *
+ * When produced by [ParallelThreadsRunner], the results are stored in the runner's
+ * reusable [buffer] and are materialized on the first [results] access. The buffer is
+ * overwritten by the next [Runner.run] call, so the [results] should be read before it;
+ * a later first access fails with [IllegalStateException] instead of returning
+ * the results of another invocation. Once read, the [results] never change.
  */
-class CompletedInvocationResult(
-    val results: ExecutionResult
-) : InvocationResult()
+class CompletedInvocationResult private constructor(
+    private var executionResult: ExecutionResult?,
+    private val resultBuffer: ExecutionResultBuffer?
+) : InvocationResult() {
+    constructor(results: ExecutionResult) : this(results, null)
+    internal constructor(buffer: ExecutionResultBuffer) : this(null, buffer)
+
+    private val bufferedInvocation = resultBuffer?.invocation ?: 0L
+
+    /**
+     * The runner's buffer with the results of this invocation,
+     * or `null` if the results are not buffered or the buffer has already been overwritten.
+     */
+    internal val buffer: ExecutionResultBuffer?
+        get() = resultBuffer?.takeIf { it.invocation == bufferedInvocation }
+
+    val results: ExecutionResult get() = executionResult ?: materializeBufferedResults()
+
+    private fun materializeBufferedResults(): ExecutionResult {
+        val buffer = checkNotNull(buffer) {
+            "The invocation results have been overwritten by the next invocation, they should be read before the next `Runner.run()` call"
+        }
+        return buffer.materialize().also { executionResult = it }
+    }
+}
 
 /**
  * Indicates that the invocation has run into deadlock or livelock found by [ManagedStrategy].
@@ -43,7 +43,7 @@ internal open class ParallelThreadsRunner(
     validationFunction: Actor?,
     stateRepresentationFunction: Method?,
     private val timeoutMs: Long, // for deadlock or livelock detection
-    private val useClocks: UseClocks // specifies whether `HBClock`-s should always be used or with some probability
+    private val useClocks: UseClocks // specifies whether `HBClock`-s should always be used, with some probability, or never
 ) : Runner(strategy, testClass, validationFunction, stateRepresentationFunction) {
     private val testName = testClass.simpleName
     internal val executor = FixedActiveThreadsExecutor(testName, scenario.nThreads) // should be closed in `close()`
@@ -65,7 +65,9 @@ internal open class ParallelThreadsRunner(
     // so that we need to synchronize them somehow. In order to update `completedOrSuspendedThreads`
     // consistently, we atomically change the status from `null` to `RESUMED` or `CANCELLED` and
     // update the counter on failure -- thus, synchronizing the threads.
-    private lateinit var completionStatuses: List<AtomicReferenceArray<CompletionStatus>>
+    private val completionStatuses = List(scenario.nThreads) { t ->
+        AtomicReferenceArray<CompletionStatus>(scenario.parallelExecution[t].size)
+    }
     private fun trySetResumedStatus(iThread: Int, actorId: Int) = completionStatuses[iThread].compareAndSet(actorId, null, CompletionStatus.RESUMED)
     private fun trySetCancelledStatus(iThread: Int, actorId: Int) = completionStatuses[iThread].compareAndSet(actorId, null, CompletionStatus.CANCELLED)
 
@@ -76,6 +78,138 @@ internal open class ParallelThreadsRunner(
     private val postPartExecution: TestThreadExecution? = createPostPartExecution()
     private val validationPartExecution: TestThreadExecution? = createValidationPartExecution(validationFunction)
 
+    // The results of completed invocations are not copied out of the thread executions;
+    // instead, they are exposed via this buffer and kept until the next `run()` call.
+    private val resultBuffer = ExecutionResultBuffer(initialPartExecution, parallelPartExecutions, postPartExecution)
+    private var hasBufferedResults = false
+
+    /**
+     * Specifies whether the state representations should be constructed after each scenario part.
+     * Strategies which can re-run a failing invocation may disable it, collecting
+     * the state representations only when the failure is reported.
+     */
+    internal var collectStateRepresentations = true
+
+    /**
+     * Specifies whether the validation function may be executed right after the post part
+     * in the same thread, without submitting a separate task to the executor.
+     */
+    protected open val canFuseValidationIntoPostPart: Boolean get() = true
+
+    private val fuseValidationIntoPostPart: Boolean get() =
+        canFuseValidationIntoPostPart && postPartExecution != null && validationPartExecution != null &&
+        instancesPerInvocation == 1
+
+    // The state representation at the end of the post part, which is constructed
+    // in the post part thread when the validation function is fused into the post part.
+    private var afterPostStateRepresentation: String? = null
+
+    /**
+     * Specifies whether the test threads should execute batches of invocations by themselves,
+     * synchronizing with each other and creating a fresh test instance for each invocation,
+     * so that a whole batch requires a single round-trip between the main thread and the executor;
+     * see [runLockstepBatch]. The results of the batched invocations are available via [selectInstanceResults].
+     * Managed strategies control the execution parts from the main thread and do not support this mode.
+     */
+    internal var runInLockstep = false
+        set(value) {
+            require(!value || strategy !is ManagedStrategy) { "Managed strategies do not support lockstep invocations" }
+            field = value
+            allocateInstanceResults()
+        }
+
+    // Scenarios with suspendable actors require resetting the completions
+    // between the invocations, so they are executed one invocation per lockstep batch.
+    private val batchLockstepInvocations: Boolean get() = runInLockstep && !scenario.hasSuspendableActors
+
+    /**
+     * The maximal number of invocations in the next lockstep batch,
+     * the strategy should limit it by the number of the remaining invocations.
+     */
+    internal var lockstepBatchLimit = Int.MAX_VALUE
+        set(value) {
+            require(value >= 1) { "The lockstep batch limit should be positive, but $value is specified" }
+            field = value
+        }
+
+    /**
+     * The number of invocations executed by the last [run] call,
+     * which is greater than one only in the [lockstep][runInLockstep] mode.
+     */
+    internal var lastRunInvocationsCount = 1
+        private set
+
+    /**
+     * The number of the test instances with the results of the last [run] call,
+     * see [selectInstanceResults]: the number of [instances per invocation][instancesPerInvocation]
+     * or the number of invocations in the lockstep batch; `1` in other cases.
+     */
+    internal var completedInstancesCount = 1
+        private set
+
+    // The state representations constructed by the test threads in the lockstep mode.
+    private var afterInitStateRepresentation: String? = null
+    private var afterParallelStateRepresentation: String? = null
+
+    // The size of the next lockstep batch; it is adapted to the observed invocation time,
+    // so that a batch takes a small fraction of the timeout, see `adaptLockstepBatchSize`.
+    private var lockstepBatchSize = 1
+    // The number of invocations in the currently executing lockstep batch.
+    private var lockstepBatchInvocations = 1
+
+    // Synchronization of the test threads in the lockstep mode.
+    @Volatile
+    private var lockstepStartedInvocations = 0
+    @Volatile
+    private var lockstepAborted = false
+    private val lockstepFinishedParallelThreads = AtomicInteger(0)
+    private val lockstepTasks = Array(scenario.nThreads) { iThread -> Runnable { runLockstepBatch(iThread) } }
+
+    /**
+     * The number of independent test instances on which each invocation executes the scenario:
+     * every thread sweeps through the instances, executing its part of the scenario on each of them,
+     * so that a single synchronization is amortized across many racing executions, see [runMultiInstanceInvocation].
+     * Scenarios with suspendable actors are always executed on a single instance.
+     */
+    internal var instancesPerInvocation = 1
+        set(value) {
+            require(value >= 1) { "The number of instances per invocation should be positive, but $value is specified" }
+            require(value == 1 || strategy !is ManagedStrategy) { "Managed strategies do not support multiple instances per invocation" }
+            field = if (scenario.hasSuspendableActors) 1 else value
+            testInstances = arrayOfNulls(field)
+            allocateInstanceResults()
+        }
+
+    // The test instances of the current invocation in the multi-instance mode.
+    private var testInstances: Array<Any?> = emptyArray()
+
+    // `instanceResults[e][k]` stores the results of `instanceExecutions[e]` on the `k`-th test instance:
+    // either in the multi-instance mode, or in the `k`-th invocation of a lockstep batch.
+    private val instanceExecutions: List<TestThreadExecution> =
+        listOfNotNull(initialPartExecution, *parallelPartExecutions, postPartExecution, validationPartExecution)
+    private var instanceResults: Array<Array<Array<Result?>>> = emptyArray()
+    // In the lockstep mode, `instanceClocks[t][k]` stores the clocks of the `t`-th parallel thread
+    // in the `k`-th invocation of the batch, and `instanceStateRepresentations[k]` stores its state representations.
+    private var instanceClocks: Array<Array<Array<IntArray>>> = emptyArray()
+    private var instanceStateRepresentations: Array<Array<String?>> = emptyArray()
+
+    private fun allocateInstanceResults() {
+        val instances = maxOf(instancesPerInvocation, if (batchLockstepInvocations) MAX_LOCKSTEP_BATCH_SIZE else 1)
+        instanceResults = Array(instanceExecutions.size) { e ->
+            Array(instances) { arrayOfNulls<Result>(instanceExecutions[e].results.size) }
+        }
+        if (!batchLockstepInvocations) return
+        instanceClocks = Array(scenario.nThreads) { t ->
+            Array(instances) { Array(scenario.parallelExecution[t].size) { emptyClockArray(scenario.nThreads) } }
+        }
+        instanceStateRepresentations = Array(instances) { arrayOfNulls(3) }
+    }
+
+    private val initialPartInstancesTask = initialPartExecution?.let { multiInstanceTask(it) }
+    private val parallelPartInstancesTasks = Array(scenario.nThreads) { iThread -> multiInstanceTask(parallelPartExecutions[iThread]) }
+    private val postPartInstancesTask = postPartExecution?.let { multiInstanceTask(it) }
+    private val validationPartInstancesTask = validationPartExecution?.let { multiInstanceTask(it) }
+
     private val testThreadExecutions: List<TestThreadExecution> = listOfNotNull(
         initialPartExecution,
         *parallelPartExecutions,
@@ -85,6 +219,12 @@ internal open class ParallelThreadsRunner(
     init {
         if (strategy is ManagedStrategy) {
             executor.threads.forEach { it.eventTracker = strategy }
+        } else {
+            // Managed strategies detect deadlocks by themselves; in the stress mode,
+            // the progress is tracked via the numbers of completed actors.
+            executor.hangWatchdog = HangWatchdog(executor.threads) {
+                testThreadExecutions.sumOf { it.completedActors.toLong() }
+            }
         }
         resetState()
     }
@@ -168,15 +308,21 @@ internal open class ParallelThreadsRunner(
                 completion.reset()
             }
         }
-        completionStatuses = List(scenario.nThreads) { t ->
-            AtomicReferenceArray<CompletionStatus>(scenario.parallelExecution[t].size)
+        completionStatuses.forEach { statuses ->
+            for (actorId in 0 until statuses.length()) statuses.set(actorId, null)
         }
         uninitializedThreads.set(scenario.nThreads)
         // reset stored continuations
         executor.threads.forEach { it.suspendedContinuation = null }
         // reset thread executions
+        resultBuffer.invalidate()
         testThreadExecutions.forEach { it.reset() }
         validationPartExecution?.results?.fill(null)
+        afterInitStateRepresentation = null
+        afterParallelStateRepresentation = null
+        afterPostStateRepresentation = null
+        lockstepStartedInvocations = 0
+        lockstepFinishedParallelThreads.set(0)
     }
 
     private var ensuredTestInstanceIsTransformed = false
@@ -285,74 +431,288 @@ internal open class ParallelThreadsRunner(
     override fun isCoroutineResumed(iThread: Int, actorId: Int) =
         suspensionPointResults[iThread][actorId] != NoResult || completions[iThread][actorId].resWithCont.get() != null
 
+    /**
+     * Note that the [results][CompletedInvocationResult.results] of the returned [CompletedInvocationResult]
+     * are stored in the re-used buffer, so they should be read before the next [run] call.
+     */
     override fun run(): InvocationResult {
+        if (hasBufferedResults) {
+            hasBufferedResults = false
+            resetState()
+        }
+        var completed = false
+        lastRunInvocationsCount = 1
+        completedInstancesCount = 1
         try {
             var timeout = timeoutMs * 1_000_000
+            // The test instances are created by `runMultiInstanceInvocation` in the multi-instance mode.
+            if (instancesPerInvocation > 1) {
+                val result = runMultiInstanceInvocation(timeout)
+                completed = result is CompletedInvocationResult
+                return result
+            }
             // Create a new testing class instance.
             createTestInstance()
+            if (runInLockstep) {
+                val result = runLockstepInvocations(timeout)
+                completed = result is CompletedInvocationResult
+                return result
+            }
             // Execute the initial part.
             initialPartExecution?.let {
                 beforePart(INIT)
                 timeout -= executor.submitAndAwait(arrayOf(it), timeout)
             }
             onThreadSwitchesOrActorFinishes()
-            val afterInitStateRepresentation = constructStateRepresentation()
+            afterInitStateRepresentation = constructStateRepresentationIfNeeded()
             // Execute the parallel part.
             beforePart(PARALLEL)
             timeout -= executor.submitAndAwait(parallelPartExecutions, timeout)
-            val afterParallelStateRepresentation: String? = constructStateRepresentation()
+            afterParallelStateRepresentation = constructStateRepresentationIfNeeded()
             onThreadSwitchesOrActorFinishes()
-            // Execute the post part.
+            // Execute the post part; the validation function is executed
+            // at the end of the post part if it can be fused (see `onFinish`).
+            val fuseValidation = fuseValidationIntoPostPart
             postPartExecution?.let {
                 beforePart(POST)
                 timeout -= executor.submitAndAwait(arrayOf(it), timeout)
             }
-            val afterPostStateRepresentation = constructStateRepresentation()
+            if (!fuseValidation) {
+                afterPostStateRepresentation = constructStateRepresentationIfNeeded()
+            }
             // Execute validation functions
             validationPartExecution?.let { validationPart ->
-                beforePart(VALIDATION)
-                executor.submitAndAwait(arrayOf(validationPart), timeout)
+                if (!fuseValidation) {
+                    beforePart(VALIDATION)
+                    executor.submitAndAwait(arrayOf(validationPart), timeout)
+                }
                 val validationResult = validationPart.results.single()
                 if (validationResult is ExceptionResult) {
                     return ValidationFailureInvocationResult(scenario, validationResult.throwable, collectExecutionResults())
                 }
             }
-            // Combine the results and convert them for the standard class loader (if they are of non-primitive types).
-            // We do not want the transformed code to be reachable outside of the runner and strategy classes.
-            return CompletedInvocationResult(collectExecutionResults(afterInitStateRepresentation, afterParallelStateRepresentation, afterPostStateRepresentation))
+            // The results are materialized lazily from the thread executions, see `ExecutionResultBuffer`.
+            resultBuffer.onInvocationCompleted(afterInitStateRepresentation, afterParallelStateRepresentation, afterPostStateRepresentation)
+            completed = true
+            return CompletedInvocationResult(resultBuffer)
         } catch (e: TimeoutException) {
             val threadDump = collectThreadDump(this)
+            // Release the test threads waiting for the hung one in the lockstep mode.
+            lockstepAborted = true
             return RunnerTimeoutInvocationResult(threadDump, collectExecutionResults())
         } catch (e: ExecutionException) {
             return UnexpectedExceptionInvocationResult(e.cause!!, collectExecutionResults())
         } finally {
-            resetState()
+            // The results of a completed invocation are reset lazily, at the beginning of the next one.
+            if (completed) hasBufferedResults = true else resetState()
         }
     }
 
     /**
-     * This method is called when we have some execution result other than [CompletedInvocationResult].
+     * Executes a batch of lockstep invocations, see [runLockstepBatch], and returns the [CompletedInvocationResult]
+     * with the results of the first invocation selected, see [selectInstanceResults];
+     * or a [ValidationFailureInvocationResult] for the invocation that failed the validation.
      */
-    fun collectExecutionResults(): ExecutionResult {
-        return collectExecutionResults(null, null, null)
+    private fun runLockstepInvocations(timeoutNano: Long): InvocationResult {
+        var timeout = timeoutNano
+        lockstepBatchInvocations = if (batchLockstepInvocations) minOf(lockstepBatchSize, lockstepBatchLimit) else 1
+        lockstepAborted = false
+        try {
+            timeout -= executor.submitAndAwaitPerThread(lockstepTasks, timeout)
+        } finally {
+            lastRunInvocationsCount = maxOf(lockstepStartedInvocations, 1)
+        }
+        validationPartExecution?.let { validationPart ->
+            val validationResult = validationPart.results.single()
+            if (validationResult is ExceptionResult) {
+                return ValidationFailureInvocationResult(scenario, validationResult.throwable, collectExecutionResults())
+            }
+        }
+        adaptLockstepBatchSize(timeoutNano - timeout)
+        if (!batchLockstepInvocations) {
+            resultBuffer.onInvocationCompleted(afterInitStateRepresentation, afterParallelStateRepresentation, afterPostStateRepresentation)
+            return CompletedInvocationResult(resultBuffer)
+        }
+        completedInstancesCount = lockstepBatchInvocations
+        return selectInstanceResults(0)
+    }
+
+    // Chooses the next batch size so that the batch takes at most 1/LOCKSTEP_BATCH_TIMEOUT_FRACTION
+    // of the timeout, so that the timeout still detects a hang in any of the batched invocations;
+    // the size is at most doubled at once, as the first invocations are usually slower.
+    private fun adaptLockstepBatchSize(batchTimeNano: Long) {
+        val invocationTimeNano = maxOf(batchTimeNano / lockstepBatchInvocations, 1)
+        val targetBatchTimeNano = timeoutMs * 1_000_000 / LOCKSTEP_BATCH_TIMEOUT_FRACTION
+        lockstepBatchSize = (targetBatchTimeNano / invocationTimeNano)
+            .coerceIn(1L, minOf(2L * lockstepBatchInvocations, MAX_LOCKSTEP_BATCH_SIZE.toLong())).toInt()
+    }
+
+    /**
+     * Executes the [iThread]-th part of a batch of lockstep invocations. The first thread starts
+     * the first invocation, executing its initial part, while the others wait for it; then, all the threads
+     * execute the parallel part. The thread that completes the parallel part last finishes the invocation,
+     * executing the post part together with the validation function, and starts the next invocation
+     * on a fresh test instance, while the other threads wait for it; so, no thread waits for a hung one.
+     * All the waits are interrupted when the batch is aborted due to a failure or the timeout.
+     */
+    private fun runLockstepBatch(iThread: Int) {
+        val invocations = lockstepBatchInvocations
+        try {
+            for (invocation in 0 until invocations) {
+                if (iThread == 0 && invocation == 0) {
+                    startLockstepInvocation(0)
+                } else {
+                    spinners[iThread].spinWaitUntil { lockstepStartedInvocations > invocation || lockstepAborted }
+                    if (lockstepAborted) return
+                }
+                parallelPartExecutions[iThread].run()
+                if (lockstepFinishedParallelThreads.incrementAndGet() < (invocation + 1) * scenario.nThreads) continue
+                if (lockstepAborted || !finishLockstepInvocation(invocation) || invocation == invocations - 1) return
+                startLockstepInvocation(invocation + 1)
+            }
+        } catch (t: Throwable) {
+            lockstepAborted = true
+            throw t
+        }
     }
 
-    private fun collectExecutionResults(
-        afterInitStateRepresentation: String?,
-        afterParallelStateRepresentation: String?,
-        afterPostStateRepresentation: String?
-    ) = ExecutionResult(
-        initResults = initialPartExecution?.results?.toList().orEmpty(),
-        parallelResultsWithClock = parallelPartExecutions.map { execution ->
-            execution.results.zip(execution.clocks).map {
-                ResultWithClock(it.first, HBClock(it.second.clone()))
+    private fun startLockstepInvocation(invocation: Int) {
+        if (invocation > 0) {
+            createTestInstance()
+            testThreadExecutions.forEach {
+                it.results.fill(null)
+                it.curClock = 0
             }
-        },
-        postResults = postPartExecution?.results?.toList().orEmpty(),
-        afterInitStateRepresentation = afterInitStateRepresentation,
-        afterParallelStateRepresentation = afterParallelStateRepresentation,
-        afterPostStateRepresentation = afterPostStateRepresentation
-    )
+            validationPartExecution?.results?.fill(null)
+            uninitializedThreads.set(scenario.nThreads)
+        }
+        beforePart(INIT)
+        initialPartExecution?.run()
+        afterInitStateRepresentation = constructStateRepresentationIfNeeded()
+        beforePart(PARALLEL)
+        lockstepStartedInvocations = invocation + 1
+    }
+
+    // Returns `false` if the validation function has failed, aborting the batch.
+    private fun finishLockstepInvocation(invocation: Int): Boolean {
+        afterParallelStateRepresentation = constructStateRepresentationIfNeeded()
+        postPartExecution?.let {
+            beforePart(POST)
+            it.run()
+        }
+        if (!fuseValidationIntoPostPart) {
+            afterPostStateRepresentation = constructStateRepresentationIfNeeded()
+            validationPartExecution?.let {
+                beforePart(VALIDATION)
+                it.run()
+            }
+        }
+        if (validationPartExecution?.results?.single() is ExceptionResult) {
+            lockstepAborted = true
+            return false
+        }
+        if (batchLockstepInvocations) storeLockstepResults(invocation)
+        return true
+    }
+
+    private fun storeLockstepResults(invocation: Int) {
+        instanceExecutions.forEachIndexed { e, execution ->
+            execution.results.copyInto(instanceResults[e][invocation])
+        }
+        parallelPartExecutions.forEachIndexed { t, execution ->
+            if (execution.useClocks) {
+                execution.clocks.forEachIndexed { i, clock -> clock.copyInto(instanceClocks[t][invocation][i]) }
+            }
+        }
+        instanceStateRepresentations[invocation].let {
+            it[0] = afterInitStateRepresentation
+            it[1] = afterParallelStateRepresentation
+            it[2] = afterPostStateRepresentation
+        }
+    }
+
+    /**
+     * Executes each scenario part on all the [testInstances]; the parts are still executed one after another.
+     * Returns the [CompletedInvocationResult] with the results on the first instance selected,
+     * see [selectInstanceResults], or a [ValidationFailureInvocationResult] for the first failed instance.
+     */
+    private fun runMultiInstanceInvocation(timeoutNano: Long): InvocationResult {
+        var timeout = timeoutNano
+        for (k in testInstances.indices) {
+            testInstances[k] = testClass.newInstance()
+        }
+        testInstance = testInstances[0]!!
+        // The clocks of different instances cannot be related.
+        parallelPartExecutions.forEach { it.useClocks = false }
+        initialPartInstancesTask?.let {
+            beforePart(INIT)
+            timeout -= executor.submitAndAwaitPerThread(arrayOf(it), timeout)
+        }
+        beforePart(PARALLEL)
+        timeout -= executor.submitAndAwaitPerThread(parallelPartInstancesTasks, timeout)
+        completedInstancesCount = instancesPerInvocation
+        postPartInstancesTask?.let {
+            beforePart(POST)
+            timeout -= executor.submitAndAwaitPerThread(arrayOf(it), timeout)
+        }
+        validationPartInstancesTask?.let {
+            beforePart(VALIDATION)
+            executor.submitAndAwaitPerThread(arrayOf(it), timeout)
+            val validationResults = instanceResults[instanceExecutions.indexOf(validationPartExecution)]
+            for (k in testInstances.indices) {
+                val validationResult = validationResults[k].single()
+                if (validationResult is ExceptionResult) {
+                    selectInstanceResults(k)
+                    return ValidationFailureInvocationResult(scenario, validationResult.throwable, collectExecutionResults())
+                }
+            }
+        }
+        return selectInstanceResults(0)
+    }
+
+    private fun multiInstanceTask(execution: TestThreadExecution) = Runnable {
+        val results = instanceResults[instanceExecutions.indexOf(execution)]
+        for (k in testInstances.indices) {
+            execution.testInstance = testInstances[k]
+            execution.results.fill(null)
+            execution.curClock = 0
+            execution.run()
+            execution.results.copyInto(results[k])
+        }
+    }
+
+    /**
+     * Returns the results of the last [run] call on the [instance]-th test instance, which is less than
+     * [completedInstancesCount]: in the multi-instance mode, or of the [instance]-th invocation of the lockstep batch;
+     * [run] returns the results on the first one. The results of the previously selected instance
+     * should be read before, as they share the same buffer.
+     */
+    fun selectInstanceResults(instance: Int): CompletedInvocationResult {
+        require(instance < completedInstancesCount) { "Only $completedInstancesCount instances have been completed" }
+        instanceExecutions.forEachIndexed { e, execution ->
+            instanceResults[e][instance].copyInto(execution.results)
+        }
+        if (instancesPerInvocation > 1) {
+            resultBuffer.onInvocationCompleted(null, null, null)
+            return CompletedInvocationResult(resultBuffer)
+        }
+        parallelPartExecutions.forEachIndexed { t, execution ->
+            if (execution.useClocks) {
+                instanceClocks[t][instance].forEachIndexed { i, clock -> clock.copyInto(execution.clocks[i]) }
+            }
+        }
+        val stateRepresentations = instanceStateRepresentations[instance]
+        resultBuffer.onInvocationCompleted(stateRepresentations[0], stateRepresentations[1], stateRepresentations[2])
+        return CompletedInvocationResult(resultBuffer)
+    }
+
+    /**
+     * This method is called when we have some execution result other than [CompletedInvocationResult].
+     */
+    fun collectExecutionResults(): ExecutionResult {
+        resultBuffer.onInvocationCompleted(null, null, null)
+        return resultBuffer.materialize()
+    }
 
 
     private fun createInitialPartExecution() =
@@ -418,21 +778,30 @@ internal open class ParallelThreadsRunner(
     private fun TestThreadExecution.reset() {
         val runner = this@ParallelThreadsRunner
         results.fill(null)
-        useClocks = if (runner.useClocks == ALWAYS) true else Random.nextBoolean()
-        clocks.forEach { it.fill(0) }
+        // The clocks are written only when they are used, so only such clocks need to be cleared.
+        if (useClocks) clocks.forEach { it.fill(0) }
+        useClocks = when (runner.useClocks) {
+            ALWAYS -> true
+            RANDOM -> Random.nextBoolean()
+            NEVER -> false
+        }
         curClock = 0
     }
 
     override fun onStart(iThread: Int) {
         if (currentExecutionPart !== PARALLEL) return
         uninitializedThreads.decrementAndGet() // this thread has finished initialization
-        // wait for other threads to start
-        spinners[iThread].spinWaitUntil { uninitializedThreads.get() == 0 }
+        // wait for other threads to start; in the multi-instance mode,
+        // the threads are synchronized only before the first instance
+        spinners[iThread].spinWaitUntil { uninitializedThreads.get() <= 0 }
     }
 
     override fun constructStateRepresentation() =
         stateRepresentationFunction?.invoke(testInstance) as String?
 
+    private fun constructStateRepresentationIfNeeded(): String? =
+        if (collectStateRepresentations && stateRepresentationFunction != null) constructStateRepresentation() else null
+
     override fun close() {
         super.close()
         executor.close()
@@ -440,11 +809,24 @@ internal open class ParallelThreadsRunner(
 
     override fun isCurrentRunnerThread(thread: Thread): Boolean = executor.threads.any { it === thread }
 
-    override fun onFinish(iThread: Int) {}
+    override fun onFinish(iThread: Int) {
+        if (currentExecutionPart === POST && fuseValidationIntoPostPart) {
+            // Execute the validation function right in the post part thread.
+            afterPostStateRepresentation = constructStateRepresentationIfNeeded()
+            beforePart(VALIDATION)
+            validationPartExecution!!.run()
+        }
+    }
 
     override fun onFailure(iThread: Int, e: Throwable) {}
 }
 
-internal enum class UseClocks { ALWAYS, RANDOM }
+internal enum class UseClocks { ALWAYS, RANDOM, NEVER }
+
+internal enum class CompletionStatus { CANCELLED, RESUMED }
+
+// The maximal number of invocations in a lockstep batch.
+private const val MAX_LOCKSTEP_BATCH_SIZE = 32
 
-internal enum class CompletionStatus { CANCELLED, RESUMED }
\ No newline at end of file
+// A lockstep batch is planned to take at most this fraction of the invocation timeout.
+private const val LOCKSTEP_BATCH_TIMEOUT_FRACTION = 16
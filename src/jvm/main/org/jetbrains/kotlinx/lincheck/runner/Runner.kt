@@ -23,7 +23,6 @@ abstract class Runner protected constructor(
     protected val validationFunction: Actor?,
     protected val stateRepresentationFunction: Method?
 ) : Closeable {
-    val classLoader = ExecutionClassLoader()
     protected val scenario: ExecutionScenario = strategy.scenario
 
     protected val completedOrSuspendedThreads = AtomicInteger(0)
@@ -35,6 +35,9 @@ public abstract class TestThreadExecution implements Runnable {
     public int[][] clocks; // for HBClock
     public volatile int curClock;
     public boolean useClocks;
+    // The number of completed actors, which is never reset;
+    // unlike `curClock`, it grows monotonically and can be used to track the progress.
+    public volatile int completedActors;
 
     public TestThreadExecution() {}
 
@@ -51,6 +54,7 @@ public abstract class TestThreadExecution implements Runnable {
     // used in byte-code generation
     public void incClock() {
         curClock++;
+        completedActors++;
     }
 
     // used in byte-code generation
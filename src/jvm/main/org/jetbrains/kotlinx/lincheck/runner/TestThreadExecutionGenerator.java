@@ -18,14 +18,17 @@ import org.objectweb.asm.commons.Method;
 import org.objectweb.asm.commons.TryCatchBlockSorter;
 import org.objectweb.asm.util.CheckClassAdapter;
 
-import java.util.ArrayList;
-import java.util.List;
+import java.util.*;
 
 import static org.objectweb.asm.Opcodes.*;
 import static org.objectweb.asm.Type.*;
 
 /**
  * This class is used to generate {@link TestThreadExecution thread executions}.
+ *
+ * <p> Generated classes depend only on the shape of the executed actors, i.e., on their methods and suspension flags,
+ * while the thread id, the actor arguments, and the completions are passed via the execution fields.
+ * Thus, the same generated class is reused for all the scenarios with the same shape.
  */
 public class TestThreadExecutionGenerator {
     private static final Type[] NO_ARGS = new Type[] {};
@@ -76,6 +79,20 @@ public class TestThreadExecutionGenerator {
     private static final Method TEST_THREAD_EXECUTION_FAIL_ON_EXCEPTION_IF_UNEXPECTED = new Method("failOnExceptionIsUnexpected", VOID_TYPE, new Type[]{INT_TYPE, THROWABLE_TYPE});
     private static int generatedClassNumber = 0;
 
+    private static final int MAX_GENERATED_CLASSES_PER_TEST_CLASS = 1024;
+
+    /**
+     * Generated execution classes of each test class by their shapes, see {@link #executionShape}.
+     * The cache is attached to the test class via {@link ClassValue}, so that it is collected
+     * together with the test class and its class loader.
+     */
+    private static final ClassValue<GeneratedClasses> generatedClasses = new ClassValue<GeneratedClasses>() {
+        @Override
+        protected GeneratedClasses computeValue(Class<?> testClass) {
+            return new GeneratedClasses();
+        }
+    };
+
     static {
         try {
             TEST_THREAD_EXECUTION_CONSTRUCTOR = Method.getMethod(TestThreadExecution.class.getDeclaredConstructor());
@@ -91,31 +108,73 @@ public class TestThreadExecutionGenerator {
                                              List<Continuation> completions,
                                              boolean scenarioContainsSuspendableActors
     ) {
-        String className = TestThreadExecution.class.getCanonicalName() + generatedClassNumber++;
-        String internalClassName = className.replace('.', '/');
-        List<Object> objArgs = new ArrayList<>();
-        Class<? extends TestThreadExecution> clz = runner.getClassLoader().defineClass(className,
-                generateClass(internalClassName, getType(runner.getTestClass()), iThread, actors, objArgs, completions, scenarioContainsSuspendableActors));
+        Class<? extends TestThreadExecution> clz = getOrGenerateClass(runner.getTestClass(), actors, scenarioContainsSuspendableActors);
         try {
             TestThreadExecution execution = clz.newInstance();
             execution.iThread = iThread;
             execution.runner = runner;
-            execution.objArgs = objArgs.toArray();
+            execution.objArgs = collectArguments(actors, completions);
             return execution;
         } catch (InstantiationException | IllegalAccessException e) {
             throw new IllegalStateException("Cannot initialize generated execution class", e);
         }
     }
 
-    private static byte[] generateClass(String internalClassName, Type testClassType, int iThread, List<Actor> actors,
-                                        List<Object> objArgs, List<Continuation> completions,
+    private static synchronized Class<? extends TestThreadExecution> getOrGenerateClass(Class<?> testClass, List<Actor> actors,
+                                                                                       boolean scenarioContainsSuspendableActors)
+    {
+        GeneratedClasses cache = generatedClasses.get(testClass);
+        List<Object> shape = executionShape(actors, scenarioContainsSuspendableActors);
+        Class<? extends TestThreadExecution> clz = cache.classes.get(shape);
+        if (clz != null) return clz;
+        // The classes cannot be unloaded one by one, so the whole cache with its class loader is dropped when full;
+        // the dropped classes are collected when the executions created from them are not used anymore.
+        if (cache.classes.size() >= MAX_GENERATED_CLASSES_PER_TEST_CLASS) cache.reset();
+        String className = TestThreadExecution.class.getCanonicalName() + generatedClassNumber++;
+        String internalClassName = className.replace('.', '/');
+        clz = cache.classLoader.defineClass(className,
+                generateClass(internalClassName, getType(testClass), actors, scenarioContainsSuspendableActors));
+        cache.classes.put(shape, clz);
+        return clz;
+    }
+
+    /**
+     * The generated code of a test class depends only on the actor methods and their suspension flags,
+     * and whether the scenario contains suspendable actors.
+     */
+    private static List<Object> executionShape(List<Actor> actors, boolean scenarioContainsSuspendableActors) {
+        List<Object> shape = new ArrayList<>(1 + 2 * actors.size());
+        shape.add(scenarioContainsSuspendableActors);
+        for (Actor actor : actors) {
+            shape.add(actor.getMethod());
+            shape.add(actor.isSuspendable());
+        }
+        return shape;
+    }
+
+    /**
+     * Collects the actor arguments and completions in the order the generated code loads them from `objArgs`.
+     */
+    private static Object[] collectArguments(List<Actor> actors, List<Continuation> completions) {
+        List<Object> objArgs = new ArrayList<>();
+        for (int i = 0; i < actors.size(); i++) {
+            Actor actor = actors.get(i);
+            objArgs.addAll(actor.getArguments());
+            if (actor.isSuspendable()) {
+                objArgs.add(completions.get(i));
+            }
+        }
+        return objArgs.toArray();
+    }
+
+    private static byte[] generateClass(String internalClassName, Type testClassType, List<Actor> actors,
                                         boolean scenarioContainsSuspendableActors)
     {
         ClassWriter cw = new ClassWriter(ClassWriter.COMPUTE_FRAMES);
         CheckClassAdapter cca = new CheckClassAdapter(cw, false);
         cca.visit(52, ACC_PUBLIC + ACC_SUPER, internalClassName, null, TEST_THREAD_EXECUTION_TYPE.getInternalName(), null);
         generateConstructor(cca);
-        generateRun(cca, testClassType, iThread, actors, objArgs, completions, scenarioContainsSuspendableActors);
+        generateRun(cca, testClassType, actors, scenarioContainsSuspendableActors);
         cca.visitEnd();
         return cw.toByteArray();
     }
@@ -130,8 +189,7 @@ public class TestThreadExecutionGenerator {
         mv.visitEnd();
     }
 
-    private static void generateRun(ClassVisitor cv, Type testType, int iThread, List<Actor> actors,
-                                    List<Object> objArgs, List<Continuation> completions,
+    private static void generateRun(ClassVisitor cv, Type testType, List<Actor> actors,
                                     boolean scenarioContainsSuspendableActors)
     {
         int access = ACC_PUBLIC;
@@ -147,15 +205,22 @@ public class TestThreadExecutionGenerator {
         mv.loadThis();
         mv.getField(TEST_THREAD_EXECUTION_TYPE, "results", RESULT_ARRAY_TYPE);
         mv.storeLocal(resLocal);
+        // Load `iThread`
+        int iThreadLocal = mv.newLocal(INT_TYPE);
+        mv.loadThis();
+        mv.getField(TEST_THREAD_EXECUTION_TYPE, "iThread", INT_TYPE);
+        mv.storeLocal(iThreadLocal);
         // Call runner's onStart(iThread) method
         mv.loadThis();
         mv.getField(TEST_THREAD_EXECUTION_TYPE, "runner", RUNNER_TYPE);
-        mv.push(iThread);
+        mv.loadLocal(iThreadLocal);
         mv.invokeVirtual(RUNNER_TYPE, RUNNER_ON_START_METHOD);
         // Number of current operation (starts with 0)
         int iLocal = mv.newLocal(INT_TYPE);
         mv.push(0);
         mv.storeLocal(iLocal);
+        // Index of the next argument in `objArgs`
+        int nextArgIndex = 0;
 
         // Invoke actors
         for (int i = 0; i < actors.size(); i++) {
@@ -179,7 +244,7 @@ public class TestThreadExecutionGenerator {
             // onActorStart call
             mv.loadThis();
             mv.getField(TEST_THREAD_EXECUTION_TYPE, "runner", RUNNER_TYPE);
-            mv.push(iThread);
+            mv.loadLocal(iThreadLocal);
             mv.invokeVirtual(RUNNER_TYPE, RUNNER_ON_ACTOR_START);
             // Load result array and index to store the current result
             mv.loadLocal(resLocal);
@@ -202,14 +267,14 @@ public class TestThreadExecutionGenerator {
             mv.getField(TEST_THREAD_EXECUTION_TYPE, "testInstance", OBJECT_TYPE);
             mv.checkCast(testType);
             // Load arguments for operation
-            loadArguments(mv, actor, objArgs, actor.isSuspendable() ? completions.get(i) : null);
+            nextArgIndex = loadArguments(mv, actor, nextArgIndex);
             // Invoke operation
             Method actorMethod = Method.getMethod(actor.getMethod());
             mv.invokeVirtual(testType, actorMethod);
             mv.box(actorMethod.getReturnType()); // box if needed
             if (scenarioContainsSuspendableActors) {
                 // process result of method invocation with ParallelThreadsRunner's processInvocationResult(result, iThread, i)
-                mv.push(iThread);
+                mv.loadLocal(iThreadLocal);
                 mv.push(i);
                 mv.invokeVirtual(PARALLEL_THREADS_RUNNER_TYPE, PARALLEL_THREADS_RUNNER_PROCESS_INVOCATION_RESULT_METHOD);
                 if (actor.getMethod().getReturnType() == void.class) {
@@ -236,7 +301,7 @@ public class TestThreadExecutionGenerator {
             mv.storeLocal(eLocal);
 
             mv.loadThis();
-            mv.push(iThread);
+            mv.loadLocal(iThreadLocal);
             mv.loadLocal(eLocal);
             // Fail if this exception is not a valid execution result
             mv.invokeVirtual(TEST_THREAD_EXECUTION_TYPE, TEST_THREAD_EXECUTION_FAIL_ON_EXCEPTION_IF_UNEXPECTED);
@@ -244,7 +309,7 @@ public class TestThreadExecutionGenerator {
             mv.loadLocal(eLocal);
 
             if (scenarioContainsSuspendableActors) {
-                storeExceptionResultFromSuspendableThrowable(mv, resLocal, iLocal, iThread, i);
+                storeExceptionResultFromSuspendableThrowable(mv, resLocal, iLocal, iThreadLocal, i);
             } else {
                 storeExceptionResultFromThrowable(mv, resLocal, iLocal);
             }
@@ -276,7 +341,7 @@ public class TestThreadExecutionGenerator {
         // Call runner's onFinish(iThread) method
         mv.loadThis();
         mv.getField(TEST_THREAD_EXECUTION_TYPE, "runner", RUNNER_TYPE);
-        mv.push(iThread);
+        mv.loadLocal(iThreadLocal);
         mv.invokeVirtual(RUNNER_TYPE, RUNNER_ON_FINISH_METHOD);
         // Complete the method
         mv.visitInsn(RETURN);
@@ -325,7 +390,7 @@ public class TestThreadExecutionGenerator {
     }
 
     // STACK: throwable
-    private static void storeExceptionResultFromSuspendableThrowable(GeneratorAdapter mv, int resLocal, int iLocal, int iThread, int actorId) {
+    private static void storeExceptionResultFromSuspendableThrowable(GeneratorAdapter mv, int resLocal, int iLocal, int iThreadLocal, int actorId) {
         int eLocal = mv.newLocal(THROWABLE_TYPE);
         mv.storeLocal(eLocal);
         mv.loadLocal(resLocal);
@@ -336,49 +401,51 @@ public class TestThreadExecutionGenerator {
         mv.checkCast(PARALLEL_THREADS_RUNNER_TYPE);
         // Load exception result
         mv.loadLocal(eLocal);
-        mv.push(iThread);
+        mv.loadLocal(iThreadLocal);
         mv.push(actorId);
         // Process result
         mv.invokeVirtual(PARALLEL_THREADS_RUNNER_TYPE, PARALLEL_THREADS_RUNNER_PROCESS_INVOCATION_RESULT_METHOD);
         mv.arrayStore(RESULT_TYPE);
     }
 
-    private static void loadArguments(GeneratorAdapter mv, Actor actor, List<Object> objArgs, Continuation completion) {
+    /**
+     * Loads the arguments of the [actor] from `objArgs`, starting from the specified index,
+     * and returns the index of the next actor arguments.
+     */
+    private static int loadArguments(GeneratorAdapter mv, Actor actor, int argIndex) {
+        Class<?>[] parameterTypes = actor.getMethod().getParameterTypes();
         int nArguments = actor.getArguments().size();
         for (int j = 0; j < nArguments; j++) {
-            pushArgumentOnStack(mv, objArgs, actor.getArguments().toArray()[j], actor.getMethod().getParameterTypes()[j]);
+            pushArgumentOnStack(mv, argIndex++, parameterTypes[j]);
         }
         if (actor.isSuspendable()) {
-            pushArgumentOnStack(mv, objArgs, completion, Continuation.class);
+            pushArgumentOnStack(mv, argIndex++, Continuation.class);
         }
+        return argIndex;
     }
 
-    private static void pushArgumentOnStack(GeneratorAdapter mv, List<Object> objArgs, Object arg, Class<?> argClass) {
-        if (argClass == boolean.class) {
-            mv.push((boolean) arg);
-        } else if (argClass == byte.class) {
-            mv.push((byte) arg);
-        } else if (argClass == char.class) {
-            mv.push((char) arg);
-        } else if (argClass == short.class) {
-            mv.push((short) arg);
-        } else if (argClass == int.class) {
-            mv.push((int) arg);
-        } else if (argClass == long.class) {
-            mv.push((long) arg);
-        } else if (argClass == float.class) {
-            mv.push((float) arg);
-        } else if (argClass == double.class) {
-            mv.push((double) arg);
-        } else if (argClass == String.class) {
-            mv.push((String) arg);
-        } else { // Object type
-            mv.loadThis(); // -> this
-            mv.getField(TEST_THREAD_EXECUTION_TYPE, "objArgs", OBJECT_ARRAY_TYPE); // this -> objArgs
-            mv.push(objArgs.size()); // objArgs -> objArgs, index
-            mv.arrayLoad(OBJECT_TYPE); // objArgs, index -> arg
+    private static void pushArgumentOnStack(GeneratorAdapter mv, int argIndex, Class<?> argClass) {
+        mv.loadThis(); // -> this
+        mv.getField(TEST_THREAD_EXECUTION_TYPE, "objArgs", OBJECT_ARRAY_TYPE); // this -> objArgs
+        mv.push(argIndex); // objArgs -> objArgs, index
+        mv.arrayLoad(OBJECT_TYPE); // objArgs, index -> arg
+        if (argClass.isPrimitive()) {
+            mv.unbox(getType(argClass)); // unbox primitive argument
+        } else {
             mv.checkCast(getType(argClass)); // cast object to argument type
-            objArgs.add(arg);
+        }
+    }
+
+    /**
+     * The execution classes generated for a test class, defined by their own class loader.
+     */
+    private static final class GeneratedClasses {
+        private ExecutionClassLoader classLoader = new ExecutionClassLoader();
+        private final Map<List<Object>, Class<? extends TestThreadExecution>> classes = new HashMap<>();
+
+        private void reset() {
+            classLoader = new ExecutionClassLoader();
+            classes.clear();
         }
     }
 }
@@ -0,0 +1,87 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.runner
+
+import sun.nio.ch.lincheck.TestThread
+import java.util.concurrent.*
+
+/**
+ * A process-wide pool of [TestThread]-s, which are re-used by [FixedActiveThreadsExecutor]-s
+ * across scenarios, iterations, and test configurations, so that the thread creation
+ * and warm-up costs are not paid for each scenario.
+ *
+ * The threads are pooled by their [thread index][TestThread.threadId], as the latter is fixed
+ * on the thread creation. When more threads with the same index are requested at the same time
+ * (e.g., several tests are run in parallel), new threads are created. The idle threads
+ * terminate after [KEEP_ALIVE_MS] milliseconds, so the pool shrinks when fewer threads are used.
+ */
+internal object TestThreadPool {
+    // `idleWorkers[i]` contains the idle workers with thread index `i`; guarded by `this`.
+    private val idleWorkers = ArrayList<ArrayDeque<Worker>>()
+
+    /**
+     * Starts executing the [job] in a thread with the specified [threadId], re-using an idle one if possible.
+     * The [job] returns whether the thread can be re-used after that; it should return `false`
+     * if the thread may be in an inconsistent state, e.g., when a hang has been detected.
+     */
+    fun start(testName: String, threadId: Int, job: () -> Boolean): TestThread {
+        val worker = synchronized(this) { idleWorkers.getOrNull(threadId)?.removeFirstOrNull() } ?: Worker(threadId)
+        worker.thread.apply {
+            name = threadName(testName, threadId)
+            eventTracker = null
+            noiseInjector = null
+            suspendedContinuation = null
+            inTestingCode = false
+            inIgnoredSection = false
+        }
+        worker.jobs.put(job)
+        return worker.thread
+    }
+
+    private fun release(worker: Worker) = synchronized(this) {
+        while (idleWorkers.size <= worker.threadId) idleWorkers.add(ArrayDeque())
+        idleWorkers[worker.threadId].addFirst(worker)
+    }
+
+    // Returns `false` if the worker has already been acquired, so that it should take the next job.
+    private fun tryRemoveIdle(worker: Worker): Boolean = synchronized(this) {
+        idleWorkers[worker.threadId].remove(worker)
+    }
+
+    private class Worker(val threadId: Int) : Runnable {
+        val jobs = LinkedBlockingQueue<() -> Boolean>()
+        val thread = TestThread("idle", threadId, this).apply {
+            isDaemon = true
+            start()
+        }
+
+        override fun run() {
+            var job: (() -> Boolean)? = jobs.take()
+            while (job != null) {
+                Thread.interrupted() // clear the interruption status left by the previous job
+                if (!job()) return
+                job = null // do not retain the finished job while being idle
+                job = nextJob()
+            }
+        }
+
+        // Returns this worker to the pool and waits for the next job; returns `null` on the keep-alive timeout.
+        private fun nextJob(): (() -> Boolean)? {
+            release(this)
+            return jobs.poll(KEEP_ALIVE_MS, TimeUnit.MILLISECONDS)
+                // the worker could have been acquired concurrently with the timeout
+                ?: if (tryRemoveIdle(this)) null else jobs.take()
+        }
+    }
+}
+
+private fun threadName(testName: String, threadId: Int) = "Lincheck-$testName-$threadId"
+
+private const val KEEP_ALIVE_MS = 60_000L
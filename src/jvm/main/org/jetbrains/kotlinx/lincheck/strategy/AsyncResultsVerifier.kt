@@ -0,0 +1,98 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.strategy
+
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.verifier.*
+import java.util.concurrent.*
+import kotlin.concurrent.*
+
+/**
+ * Verifies the invocation results of the given [scenario] in a separate thread,
+ * so that the strategy can proceed with the next invocations meanwhile.
+ *
+ * The results are passed to the worker thread through a bounded queue,
+ * [submit] blocks when the queue is full. The [verifier] is accessed only by
+ * the worker thread until [awaitCompletion] returns, as verifiers are not thread-safe.
+ * The results are verified in the submission order, so that the [failure]
+ * is always the earliest submitted incorrect result.
+ */
+internal class AsyncResultsVerifier(
+    private val verifier: Verifier,
+    private val scenario: ExecutionScenario,
+    queueCapacity: Int = DEFAULT_QUEUE_CAPACITY
+) {
+    private val queue = ArrayBlockingQueue<Any>(queueCapacity)
+
+    @Volatile
+    private var failedResults: ExecutionResult? = null
+    @Volatile
+    private var verifierException: Throwable? = null
+
+    /**
+     * The number of verified results, and the total time of their verification;
+     * they are written by the worker thread and should be read after [awaitCompletion].
+     */
+    var verificationsCount = 0
+        private set
+    var verificationTimeNanos = 0L
+        private set
+
+    /**
+     * The earliest submitted results for which the verification has failed, if already found.
+     */
+    val failure: ExecutionResult? get() = failedResults
+
+    private val worker: Thread
+
+    init {
+        // The worker is started after all the fields above are initialized.
+        worker = thread(name = "Lincheck-verifier", isDaemon = true) {
+            while (true) {
+                val results = queue.take()
+                if (results === STOP) break
+                // Skip the remaining results after a failure, the first one is reported.
+                if (failedResults != null || verifierException != null) continue
+                val startTime = System.nanoTime()
+                try {
+                    if (!verifier.verifyResults(scenario, results as ExecutionResult)) failedResults = results
+                } catch (t: Throwable) {
+                    verifierException = t
+                } finally {
+                    verificationsCount++
+                    verificationTimeNanos += System.nanoTime() - startTime
+                }
+            }
+        }
+    }
+
+    /**
+     * Passes the [results] for verification, blocks while the queue is full.
+     */
+    fun submit(results: ExecutionResult) {
+        queue.put(results)
+    }
+
+    /**
+     * Waits until all the submitted results are verified and stops the worker thread.
+     * Returns the earliest incorrect results, or `null` if all the results are correct.
+     * If the verifier has thrown an exception, it is re-thrown here.
+     */
+    fun awaitCompletion(): ExecutionResult? {
+        queue.put(STOP)
+        worker.join()
+        verifierException?.let { throw it }
+        return failedResults
+    }
+}
+
+private val STOP = Any()
+
+private const val DEFAULT_QUEUE_CAPACITY = 64
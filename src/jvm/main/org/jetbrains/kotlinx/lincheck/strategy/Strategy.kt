@@ -24,6 +24,69 @@ abstract class Strategy protected constructor(
 ) {
     abstract fun run(): LincheckFailure?
 
+    /**
+     * The [System.nanoTime] moment after which [run] should not start new invocations;
+     * if set, it replaces the invocations limit of the test configuration.
+     */
+    internal var invocationsDeadlineNanos: Long? = null
+
+    /**
+     * The number of invocations performed by [run].
+     */
+    var invocationsCount: Int = 0
+        protected set
+
+    /**
+     * The number of results verifications performed by [run], and their total time.
+     */
+    internal var verificationsCount: Int = 0
+    internal var verificationTimeNanos: Long = 0
+
+    /**
+     * The number of switch points passed by the managed strategies during [run].
+     */
+    internal var switchPointsCount: Long = 0
+
+    /**
+     * The number of invocations re-run by the managed strategies after a livelock has been detected,
+     * to replay the spin cycle with the collected knowledge about it; they are not counted in [invocationsCount].
+     */
+    internal var livelockReplaysCount: Int = 0
+
+    /**
+     * The number of nodes in the interleaving tree after [run],
+     * or `0` if the strategy does not enumerate the interleavings.
+     */
+    internal open val interleavingTreeSize: Int get() = 0
+
+    /**
+     * The progress of the interleavings exploration after [run],
+     * or `null` if the strategy does not enumerate the interleavings.
+     */
+    internal open val explorationProgress: ExplorationProgress? get() = null
+
+    /**
+     * Checks whether the next invocation fits into the limits: at most [maxInvocations] invocations,
+     * or, if [invocationsDeadlineNanos] is set, at least one invocation and then until the deadline.
+     */
+    protected fun canRunNextInvocation(maxInvocations: Int): Boolean {
+        val deadline = invocationsDeadlineNanos ?: return invocationsCount < maxInvocations
+        return invocationsCount == 0 || System.nanoTime() < deadline
+    }
+
+    /**
+     * Runs the results [verification], accounting it in [verificationsCount] and [verificationTimeNanos].
+     */
+    internal inline fun <T> measureVerification(verification: () -> T): T {
+        val startTime = System.nanoTime()
+        try {
+            return verification()
+        } finally {
+            verificationsCount++
+            verificationTimeNanos += System.nanoTime() - startTime
+        }
+    }
+
     open fun beforePart(part: ExecutionPart) {}
 
     /**
@@ -36,3 +99,14 @@ abstract class Strategy protected constructor(
      */
     open fun onActorFinish() {}
 }
+
+/**
+ * Describes how much of the interleavings with at most [maxSwitches] context switches
+ * has been studied; the exploration is [complete][isFullyExplored] when there are
+ * no more interleavings with any number of switches.
+ */
+internal class ExplorationProgress(
+    val maxSwitches: Int,
+    val exploredFraction: Double,
+    val isFullyExplored: Boolean
+)
@@ -32,7 +32,8 @@ abstract class ManagedCTestConfiguration(
     minimizeFailedScenario: Boolean,
     sequentialSpecification: Class<*>,
     timeoutMs: Long,
-    customScenarios: List<ExecutionScenario>
+    customScenarios: List<ExecutionScenario>,
+    testingTimeMs: Long = CTestConfiguration.NO_TESTING_TIME_LIMIT
 ) : CTestConfiguration(
     testClass = testClass,
     iterations = iterations,
@@ -45,7 +46,8 @@ abstract class ManagedCTestConfiguration(
     minimizeFailedScenario = minimizeFailedScenario,
     sequentialSpecification = sequentialSpecification,
     timeoutMs = timeoutMs,
-    customScenarios = customScenarios
+    customScenarios = customScenarios,
+    testingTimeMs = testingTimeMs
 ) {
     companion object {
         const val DEFAULT_INVOCATIONS = 10000
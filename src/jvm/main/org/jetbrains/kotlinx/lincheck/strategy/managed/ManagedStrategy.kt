@@ -94,6 +94,9 @@ abstract class ManagedStrategy(
     // Collector of all events in the execution such as thread switches.
     private var traceCollector: TraceCollector? = null // null when `collectTrace` is false
 
+    // The result of the invocation re-run to collect the trace, see `collectTrace`.
+    private var tracedInvocationResult: InvocationResult? = null
+
     // Stores the currently executing methods call stack for each thread.
     private val callStackTrace = Array(nThreads) { mutableListOf<CallStackTraceElement>() }
 
@@ -140,8 +143,12 @@ abstract class ManagedStrategy(
             validationFunction = validationFunction,
             stateRepresentationMethod = stateRepresentationFunction,
             timeoutMs = getTimeOutMs(this, testCfg.timeoutMs),
-            useClocks = UseClocks.ALWAYS
-        )
+            useClocks = if (verifier.usesClocks()) UseClocks.ALWAYS else UseClocks.NEVER
+        ).also {
+            // State representations are reported only along with the trace,
+            // so they are collected only when the failing invocation is re-run.
+            it.collectStateRepresentations = collectTrace
+        }
 
     override fun run(): LincheckFailure? = try {
         runImpl()
@@ -206,21 +213,33 @@ abstract class ManagedStrategy(
      */
     protected fun checkResult(result: InvocationResult): LincheckFailure? = when (result) {
         is CompletedInvocationResult -> {
-            if (verifier.verifyResults(scenario, result.results)) null
-            else IncorrectResultsFailure(scenario, result.results, collectTrace(result))
+            if (measureVerification { verifier.verifyResults(scenario, result.results) }) null
+            else result.toTracedLincheckFailure()
         }
         // In case the runner detects a deadlock,
         // some threads can still work with the current strategy instance
         // and simultaneously adding events to the TraceCollector, which leads to an inconsistent trace.
         // Therefore, if the runner detects a deadlock, we don’t even try to collect a trace.
         is RunnerTimeoutInvocationResult -> result.toLincheckFailure(scenario, trace = null)
-        else -> result.toLincheckFailure(scenario, collectTrace(result))
+        else -> result.toTracedLincheckFailure()
+    }
+
+    /**
+     * Re-runs the failing invocation to collect its trace and reports the failure by the re-run invocation result,
+     * as only the re-run invocation collects the state representations.
+     */
+    private fun InvocationResult.toTracedLincheckFailure(): LincheckFailure {
+        val trace = collectTrace(this)
+        // The re-run result is checked to be of the same type and with the same results when the trace is collected.
+        val reportedResult = tracedInvocationResult?.takeIf { trace != null } ?: this
+        return reportedResult.toLincheckFailure(scenario, trace)
     }
 
     /**
      * Re-runs the last invocation to collect its trace.
      */
     private fun collectTrace(failingResult: InvocationResult): Trace? {
+        tracedInvocationResult = null
         val detectedByStrategy = suddenInvocationResult != null
         val canCollectTrace = when {
             detectedByStrategy -> true // ObstructionFreedomViolationInvocationResult or UnexpectedExceptionInvocationResult
@@ -245,6 +264,7 @@ abstract class ManagedStrategy(
         runner.close()
         runner = createRunner()
         val loggedResults = runInvocation()
+        tracedInvocationResult = loggedResults
         // In case the runner detects a deadlock, some threads can still be in an active state,
         // simultaneously adding events to the TraceCollector, which leads to an inconsistent trace.
         // Therefore, if the runner detects deadlock, we don't even try to collect trace.
@@ -340,6 +360,7 @@ abstract class ManagedStrategy(
         if (suddenInvocationResult != null) throw ForcibleExecutionFinishError
         // check we are in the right thread
         check(iThread == currentThread)
+        switchPointsCount++
         // check if we need to switch
         val shouldSwitch = when {
             /*
@@ -1580,6 +1601,9 @@ internal class ManagedStrategyRunner(
         managedStrategy.onFinish(iThread)
     }
 
+    // The validation part is a separate part of the trace, so it is executed as a separate task.
+    override val canFuseValidationIntoPostPart: Boolean get() = false
+
     override fun onFailure(iThread: Int, e: Throwable) = runInIgnoredSection {
         managedStrategy.onFailure(iThread, e)
     }
@@ -10,6 +10,7 @@
 package org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking
 
 import org.jetbrains.kotlinx.lincheck.Actor
+import org.jetbrains.kotlinx.lincheck.CTestConfiguration
 import org.jetbrains.kotlinx.lincheck.execution.*
 import org.jetbrains.kotlinx.lincheck.strategy.*
 import org.jetbrains.kotlinx.lincheck.strategy.managed.*
@@ -26,7 +27,8 @@ class ModelCheckingCTestConfiguration(testClass: Class<*>, iterations: Int, thre
                                       checkObstructionFreedom: Boolean, hangingDetectionThreshold: Int, invocationsPerIteration: Int,
                                       guarantees: List<ManagedStrategyGuarantee>, minimizeFailedScenario: Boolean,
                                       sequentialSpecification: Class<*>, timeoutMs: Long,
-                                      customScenarios: List<ExecutionScenario>
+                                      customScenarios: List<ExecutionScenario>,
+                                      testingTimeMs: Long = CTestConfiguration.NO_TESTING_TIME_LIMIT
 ) : ManagedCTestConfiguration(
     testClass = testClass,
     iterations = iterations,
@@ -43,7 +45,8 @@ class ModelCheckingCTestConfiguration(testClass: Class<*>, iterations: Int, thre
     minimizeFailedScenario = minimizeFailedScenario,
     sequentialSpecification = sequentialSpecification,
     timeoutMs = timeoutMs,
-    customScenarios = customScenarios
+    customScenarios = customScenarios,
+    testingTimeMs = testingTimeMs
 ) {
 
     override val instrumentationMode: InstrumentationMode get() = MODEL_CHECKING
@@ -46,40 +46,52 @@ internal class ModelCheckingStrategy(
 ) : ManagedStrategy(testClass, scenario, verifier, validationFunction, stateRepresentation, testCfg) {
     // The number of invocations that the strategy is eligible to use to search for an incorrect execution.
     private val maxInvocations = testCfg.invocationsPerIteration
-    // The number of already used invocations.
-    private var usedInvocations = 0
     // The maximum number of thread switch choices that strategy should perform
     // (increases when all the interleavings with the current depth are studied).
     private var maxNumberOfSwitches = 0
+    // The number of nodes in the interleaving tree, it is updated when the nodes are added or removed;
+    // should be initialized before the root node.
+    private var treeSize = 0
     // The root of the interleaving tree that chooses the starting thread.
     private var root: InterleavingTreeNode = ThreadChoosingNode((0 until nThreads).toList())
     // This random is used for choosing the next unexplored interleaving node in the tree.
-    private val generationRandom = Random(0)
+    private val generationRandom = Random(randomSeed)
     // The interleaving that will be studied on the next invocation.
     private lateinit var currentInterleaving: Interleaving
+    // Becomes true when all the interleavings have been studied.
+    private var isFullyExplored = false
+
+    override val explorationProgress: ExplorationProgress get() =
+        ExplorationProgress(maxNumberOfSwitches, if (isFullyExplored) 1.0 else 1.0 - root.fractionUnexplored, isFullyExplored)
+
+    override val interleavingTreeSize: Int get() = treeSize
 
     override fun runImpl(): LincheckFailure? {
-        currentInterleaving = root.nextInterleaving() ?: return null
-        while (usedInvocations < maxInvocations) {
+        currentInterleaving = nextInterleaving() ?: return null
+        while (canRunNextInvocation(maxInvocations)) {
             // run invocation and check its results
             val invocationResult = runInvocation()
             if (suddenInvocationResult is SpinCycleFoundAndReplayRequired) {
                 // Restart the current interleaving with
                 // the collected knowledge about the detected spin loop.
+                livelockReplaysCount++
                 currentInterleaving.rollbackAfterSpinCycleFound()
                 continue
             }
-            usedInvocations++
+            invocationsCount++
             checkResult(invocationResult)?.let { failure ->
                 runReplayIfPluginEnabled(failure)
                 return failure
             }
             // get new unexplored interleaving
-            currentInterleaving = root.nextInterleaving() ?: break
+            currentInterleaving = nextInterleaving() ?: break
         }
         return null
     }
 
+    private fun nextInterleaving(): Interleaving? =
+        root.nextInterleaving().also { if (it == null) isFullyExplored = true }
+
     /**
      * If the plugin enabled and the failure has a trace, passes information about
      * the trace and the failure to the Plugin and run re-run execution to debug it.
@@ -330,12 +342,17 @@ internal class ModelCheckingStrategy(
      * An abstract node with an execution choice in the interleaving tree.
      */
     private abstract inner class InterleavingTreeNode {
-        private var fractionUnexplored = 1.0
+        var fractionUnexplored = 1.0
+            private set
         lateinit var choices: List<Choice>
         var isFullyExplored: Boolean = false
             protected set
         val isInitialized get() = ::choices.isInitialized
 
+        init {
+            treeSize++
+        }
+
         fun nextInterleaving(): Interleaving? {
             if (isFullyExplored) {
                 // Increase the maximum number of switches that can be used,
@@ -465,7 +482,11 @@ internal class ModelCheckingStrategy(
         }
 
         fun rollbackAfterSpinCycleFound() {
-            lastNotInitializedNodeChoices?.clear()
+            lastNotInitializedNodeChoices?.let { choices ->
+                // The removed thread choosing nodes have only not initialized children.
+                treeSize -= choices.sumOf { 1 + it.node.choices.size }
+                choices.clear()
+            }
         }
 
         fun chooseThread(iThread: Int): Int =
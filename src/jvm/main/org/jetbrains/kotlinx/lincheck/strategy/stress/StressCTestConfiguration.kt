@@ -23,7 +23,12 @@ class StressCTestConfiguration(
     testClass: Class<*>, iterations: Int, threads: Int, actorsPerThread: Int, actorsBefore: Int, actorsAfter: Int,
     generatorClass: Class<out ExecutionGenerator>, verifierClass: Class<out Verifier>,
     val invocationsPerIteration: Int, minimizeFailedScenario: Boolean,
-    sequentialSpecification: Class<*>, timeoutMs: Long, customScenarios: List<ExecutionScenario>
+    sequentialSpecification: Class<*>, timeoutMs: Long, customScenarios: List<ExecutionScenario>,
+    val pipelinedVerification: Boolean = DEFAULT_PIPELINED_VERIFICATION,
+    val lockstepInvocations: Boolean = DEFAULT_LOCKSTEP_INVOCATIONS,
+    val instancesPerInvocation: Int = DEFAULT_INSTANCES_PER_INVOCATION,
+    val noiseProbability: Double = DEFAULT_NOISE_PROBABILITY,
+    testingTimeMs: Long = CTestConfiguration.NO_TESTING_TIME_LIMIT
 ) : CTestConfiguration(
     testClass = testClass,
     iterations = iterations,
@@ -36,10 +41,12 @@ class StressCTestConfiguration(
     minimizeFailedScenario = minimizeFailedScenario,
     sequentialSpecification = sequentialSpecification,
     timeoutMs = timeoutMs,
-    customScenarios = customScenarios
+    customScenarios = customScenarios,
+    testingTimeMs = testingTimeMs
 ) {
 
-    override val instrumentationMode: InstrumentationMode get() = STRESS
+    override val instrumentationMode: InstrumentationMode get() =
+        if (noiseProbability > 0) STRESS_WITH_NOISE else STRESS
 
     override fun createStrategy(testClass: Class<*>, scenario: ExecutionScenario, validationFunction: Actor?,
                                 stateRepresentationMethod: Method?, verifier: Verifier) =
@@ -47,5 +54,9 @@ class StressCTestConfiguration(
 
     companion object {
         const val DEFAULT_INVOCATIONS = 10000
+        const val DEFAULT_PIPELINED_VERIFICATION = false
+        const val DEFAULT_LOCKSTEP_INVOCATIONS = false
+        const val DEFAULT_INSTANCES_PER_INVOCATION = 1
+        const val DEFAULT_NOISE_PROBABILITY = 0.0
     }
 }
@@ -0,0 +1,88 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.strategy.stress
+
+import sun.nio.ch.lincheck.NoiseInjector
+
+/**
+ * Randomly perturbs the test threads before their shared memory accesses,
+ * so that the low-probability interleavings occur more often in the stress mode.
+ *
+ * The noise is injected with the specified [probability], scaled by the *heat* of the accessed location:
+ * a location becomes hotter when it is accessed by different threads one after another,
+ * and cools down when it is accessed by the same thread. Thus, the noise concentrates
+ * on the locations that are actually shared, while thread-local accesses are rarely delayed.
+ * The heat table is shared by the threads and updated without synchronization, as it is only a heuristic.
+ */
+internal class StressNoise(private val probability: Double) {
+    // Locations are hashed into the tables below, so that they need no registration.
+    private val heat = IntArray(HEAT_TABLE_SIZE)
+    private val lastThread = IntArray(HEAT_TABLE_SIZE)
+
+    /**
+     * Creates the noise injector for the test thread with the specified index.
+     */
+    fun injector(iThread: Int): NoiseInjector = Injector(iThread)
+
+    private inner class Injector(private val iThread: Int) : NoiseInjector {
+        private var random = System.nanoTime() * 31 + iThread or 1 // the xorshift state should not be zero
+
+        override fun beforeSharedMemoryAccess(location: Int) {
+            val slot = (location xor (location ushr 16)) and (HEAT_TABLE_SIZE - 1)
+            val locationHeat = updateHeat(slot)
+            val threshold = probability * (1 + locationHeat) / (1 + MAX_HEAT)
+            if (nextDouble() >= threshold) return
+            val delay = nextInt() and (MAX_SPIN_WAITS - 1)
+            when (delay % 3) {
+                0 -> repeat(delay) { Thread.onSpinWait() }
+                1 -> Thread.yield()
+                else -> {
+                    val deadline = System.nanoTime() + delay * BUSY_DELAY_NANOS_PER_UNIT
+                    while (System.nanoTime() < deadline) Thread.onSpinWait()
+                }
+            }
+        }
+
+        private fun updateHeat(slot: Int): Int {
+            val threadMark = iThread + 1 // 0 means that the location has not been accessed yet
+            var h = heat[slot]
+            if (lastThread[slot] != threadMark) {
+                lastThread[slot] = threadMark
+                h = minOf(h + HEAT_INCREMENT, MAX_HEAT)
+            } else if (h > 0) {
+                h--
+            }
+            heat[slot] = h
+            return h
+        }
+
+        private fun nextLong(): Long {
+            var x = random
+            x = x xor (x shl 13)
+            x = x xor (x ushr 7)
+            x = x xor (x shl 17)
+            random = x
+            return x
+        }
+
+        private fun nextInt(): Int = (nextLong() ushr 32).toInt()
+
+        private fun nextDouble(): Double = (nextLong() ushr 11) * DOUBLE_UNIT
+    }
+}
+
+private const val HEAT_TABLE_SIZE = 4096
+private const val MAX_HEAT = 15
+private const val HEAT_INCREMENT = 4
+
+private const val MAX_SPIN_WAITS = 1024
+private const val BUSY_DELAY_NANOS_PER_UNIT = 10L // up to ~10 microseconds
+
+private const val DOUBLE_UNIT = 1.0 / (1L shl 53)
@@ -17,6 +17,10 @@ import org.jetbrains.kotlinx.lincheck.chooseSequentialSpecification
  */
 open class StressOptions : Options<StressOptions, StressCTestConfiguration>() {
     private var invocationsPerIteration = StressCTestConfiguration.DEFAULT_INVOCATIONS
+    private var pipelinedVerification = StressCTestConfiguration.DEFAULT_PIPELINED_VERIFICATION
+    private var lockstepInvocations = StressCTestConfiguration.DEFAULT_LOCKSTEP_INVOCATIONS
+    private var instancesPerInvocation = StressCTestConfiguration.DEFAULT_INSTANCES_PER_INVOCATION
+    private var noiseProbability = StressCTestConfiguration.DEFAULT_NOISE_PROBABILITY
 
     /**
      * Run each test scenario the specified number of times.
@@ -25,6 +29,47 @@ open class StressOptions : Options<StressOptions, StressCTestConfiguration>() {
         invocationsPerIteration = invocations
     }
 
+    /**
+     * Verify the invocation results in a separate thread while the next invocations are running.
+     * The failures are still reported in the invocation order; disabled by default.
+     */
+    fun pipelinedVerification(pipelined: Boolean): StressOptions = apply {
+        pipelinedVerification = pipelined
+    }
+
+    /**
+     * Let the test threads execute batches of invocations by themselves, each on a fresh test instance,
+     * synchronizing with each other instead of the main thread and handing the results over per batch.
+     * This reduces the per-invocation overhead, so the operations overlap more often; disabled by default.
+     * The batch size is adapted so that a batch takes a small fraction of the invocation timeout;
+     * scenarios with suspendable operations are executed one invocation per batch.
+     */
+    fun lockstepInvocations(lockstep: Boolean): StressOptions = apply {
+        lockstepInvocations = lockstep
+    }
+
+    /**
+     * Execute each invocation on the specified number of independent test instances:
+     * every thread runs its part of the scenario on the first instance, then on the second one, and so on,
+     * while the results on each instance are verified separately. This increases the number of racing
+     * executions per synchronization; scenarios with suspendable operations always use a single instance.
+     * Invocations on multiple instances are not executed in [lockstep][lockstepInvocations].
+     */
+    fun instancesPerInvocation(instances: Int): StressOptions = apply {
+        instancesPerInvocation = instances
+    }
+
+    /**
+     * Inject randomized delays (spin-waits, yields, and busy waits) before the shared memory accesses
+     * of the test threads with the specified probability, so that rare interleavings occur more often.
+     * The probability is lowered for the locations which are not accessed by different threads in turn.
+     * Requires instrumenting the accesses, similarly to the model checking; disabled by default.
+     */
+    fun noiseProbability(probability: Double): StressOptions = apply {
+        require(probability in 0.0..1.0) { "The noise probability should be in [0, 1], but $probability is found" }
+        noiseProbability = probability
+    }
+
     override fun createTestConfigurations(testClass: Class<*>): StressCTestConfiguration {
         return StressCTestConfiguration(
             testClass = testClass,
@@ -39,7 +84,12 @@ open class StressOptions : Options<StressOptions, StressCTestConfiguration>() {
             minimizeFailedScenario = minimizeFailedScenario,
             sequentialSpecification = chooseSequentialSpecification(sequentialSpecification, testClass),
             timeoutMs = timeoutMs,
-            customScenarios = customScenarios
+            customScenarios = customScenarios,
+            pipelinedVerification = pipelinedVerification,
+            lockstepInvocations = lockstepInvocations,
+            instancesPerInvocation = instancesPerInvocation,
+            noiseProbability = noiseProbability,
+            testingTimeMs = testingTimeMs
         )
     }
 }
@@ -25,28 +25,96 @@ class StressStrategy(
     private val verifier: Verifier
 ) : Strategy(scenario) {
     private val invocations = testCfg.invocationsPerIteration
+    private val pipelinedVerification = testCfg.pipelinedVerification
     private val runner = ParallelThreadsRunner(
         strategy = this,
         testClass = testClass,
         validationFunction = validationFunction,
         stateRepresentationFunction = stateRepresentationFunction,
         timeoutMs = testCfg.timeoutMs,
-        useClocks = UseClocks.RANDOM
-    )
+        useClocks = if (verifier.usesClocks()) UseClocks.RANDOM else UseClocks.NEVER
+    ).apply {
+        runInLockstep = testCfg.lockstepInvocations
+        instancesPerInvocation = testCfg.instancesPerInvocation
+        if (testCfg.noiseProbability > 0) {
+            val noise = StressNoise(testCfg.noiseProbability)
+            executor.threads.forEachIndexed { iThread, thread -> thread.noiseInjector = noise.injector(iThread) }
+        }
+    }
 
     override fun run(): LincheckFailure? {
         runner.use {
-            // Run invocations
-            for (invocation in 0 until invocations) {
-                when (val ir = runner.run()) {
-                    is CompletedInvocationResult -> {
-                        if (!verifier.verifyResults(scenario, ir.results))
-                            return IncorrectResultsFailure(scenario, ir.results)
+            val asyncVerifier = if (pipelinedVerification) AsyncResultsVerifier(verifier, scenario) else null
+            var failure: LincheckFailure? = null
+            try {
+                // Run invocations
+                while (canRunNextInvocation(invocations)) {
+                    // In the lockstep mode, a run executes a batch of invocations.
+                    if (invocationsDeadlineNanos == null) runner.lockstepBatchLimit = invocations - invocationsCount
+                    val ir = runner.run()
+                    invocationsCount += runner.lastRunInvocationsCount
+                    if (ir !is CompletedInvocationResult) {
+                        failure = ir.toLincheckFailure(scenario)
+                        break
                     }
-                    else -> return ir.toLincheckFailure(scenario)
+                    failure = checkResults(ir, asyncVerifier)
+                    if (failure != null || asyncVerifier?.failure != null) break
                 }
+            } catch (t: Throwable) {
+                // Stop the worker thread without hiding the original exception.
+                try {
+                    asyncVerifier?.awaitCompletion()
+                } catch (e: Throwable) {
+                    t.addSuppressed(e)
+                }
+                throw t
+            }
+            asyncVerifier?.let {
+                // The asynchronously verified results precede the last invocation,
+                // so their failure should be reported first.
+                it.awaitCompletion()?.let { results -> failure = IncorrectResultsFailure(scenario, results) }
+                verificationsCount += it.verificationsCount
+                verificationTimeNanos += it.verificationTimeNanos
             }
-            return null
+            return failure
         }
     }
-}
\ No newline at end of file
+
+    // In the multi-instance mode and for lockstep batches, the results
+    // on each test instance are checked separately.
+    private fun checkResults(ir: CompletedInvocationResult, asyncVerifier: AsyncResultsVerifier?): LincheckFailure? {
+        for (instance in 0 until runner.completedInstancesCount) {
+            val instanceResult = if (instance == 0) ir else runner.selectInstanceResults(instance)
+            if (asyncVerifier != null) {
+                submitResults(asyncVerifier, instanceResult)
+            } else if (!measureVerification { verifyResults(instanceResult) }) {
+                return IncorrectResultsFailure(scenario, instanceResult.results)
+            }
+        }
+        return null
+    }
+
+    // Most invocations produce one of a few distinct results, which are already cached
+    // by the verifier; they are looked up by the fingerprint of the runner's result buffer
+    // without materializing a new `ExecutionResult`.
+    private fun verifyResults(ir: CompletedInvocationResult): Boolean {
+        val buffer = ir.buffer
+        if (buffer != null && verifier is CachedVerifier && verifier.isVerified(scenario, buffer.fingerprint(), buffer))
+            return true
+        return verifier.verifyResults(scenario, ir.results)
+    }
+
+    // In the pipelined mode, the verifier is owned by the worker thread, so the
+    // results are deduplicated against the already submitted ones instead:
+    // equal results are verified identically, and the first one is reported on failure.
+    private val submittedResults = ResultFingerprintSet(Int.MAX_VALUE)
+
+    private fun submitResults(asyncVerifier: AsyncResultsVerifier, ir: CompletedInvocationResult) {
+        val buffer = ir.buffer ?: return asyncVerifier.submit(ir.results)
+        val fingerprint = buffer.fingerprint()
+        if (submittedResults.contains(fingerprint, buffer)) return
+        val results = ir.results
+        submittedResults.add(fingerprint, results)
+        asyncVerifier.submit(results)
+    }
+}
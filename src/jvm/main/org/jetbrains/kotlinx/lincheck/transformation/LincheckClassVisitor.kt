@@ -31,6 +31,7 @@ internal class LincheckClassVisitor(
     private lateinit var className: String
     private var classVersion = 0
     private var fileName: String? = null
+    private var noiseLocations = 0
 
     override fun visitField(
         access: Int,
@@ -74,12 +75,13 @@ internal class LincheckClassVisitor(
     ): MethodVisitor {
         var mv = super.visitMethod(access, methodName, desc, signature, exceptions)
         if (access and ACC_NATIVE != 0) return mv
-        if (instrumentationMode == STRESS) {
-            return if (methodName != "<clinit>" && methodName != "<init>") {
-                CoroutineCancellabilitySupportMethodTransformer(mv, access, methodName, desc)
-            } else {
-                mv
+        if (instrumentationMode == STRESS || instrumentationMode == STRESS_WITH_NOISE) {
+            if (methodName == "<clinit>" || methodName == "<init>") return mv
+            mv = CoroutineCancellabilitySupportMethodTransformer(mv, access, methodName, desc)
+            if (instrumentationMode == STRESS_WITH_NOISE) {
+                mv = NoiseInjectionTransformer(methodName, GeneratorAdapter(mv, access, methodName, desc))
             }
+            return mv
         }
         if (methodName == "<clinit>" ||
             // Debugger implicitly evaluates toString for variables rendering
@@ -781,6 +783,53 @@ internal class LincheckClassVisitor(
         }
     }
 
+    /**
+     * Adds invocations of the stress-mode noise injector before reads and writes of shared variables
+     * and atomic operations. Unlike [SharedVariableAccessMethodTransformer], it does not expose
+     * the accessed values, so the injection does not change the operand stack.
+     */
+    private inner class NoiseInjectionTransformer(methodName: String, adapter: GeneratorAdapter) :
+        ManagedStrategyMethodVisitor(methodName, adapter) {
+
+        override fun visitFieldInsn(opcode: Int, owner: String, fieldName: String, desc: String) = adapter.run {
+            if (!isCoroutineInternalClass(owner) && !isCoroutineStateMachineClass(owner) &&
+                !FinalFields.isFinalField(owner, fieldName)) {
+                invokeBeforeSharedMemoryAccess()
+            }
+            visitFieldInsn(opcode, owner, fieldName, desc)
+        }
+
+        override fun visitInsn(opcode: Int) = adapter.run {
+            when (opcode) {
+                AALOAD, LALOAD, FALOAD, DALOAD, IALOAD, BALOAD, CALOAD, SALOAD,
+                AASTORE, IASTORE, FASTORE, BASTORE, CASTORE, SASTORE, LASTORE, DASTORE -> {
+                    invokeBeforeSharedMemoryAccess()
+                }
+            }
+            visitInsn(opcode)
+        }
+
+        override fun visitMethodInsn(opcode: Int, owner: String, name: String, desc: String, itf: Boolean) = adapter.run {
+            if (owner == "sun/misc/Unsafe" ||
+                owner == "jdk/internal/misc/Unsafe" ||
+                owner == "java/lang/invoke/VarHandle" ||
+                owner.startsWith("java/util/concurrent/") && (owner.contains("Atomic")) ||
+                owner.startsWith("kotlinx/atomicfu/") && (owner.contains("Atomic"))
+            ) {
+                invokeBeforeSharedMemoryAccess()
+            }
+            visitMethodInsn(opcode, owner, name, desc, itf)
+        }
+
+        private fun GeneratorAdapter.invokeBeforeSharedMemoryAccess() {
+            // The noise locations are not registered in [CodeLocations], as they are never reported.
+            push(nextNoiseLocation())
+            invokeStatic(Injections::beforeSharedMemoryAccess)
+        }
+    }
+
+    private fun nextNoiseLocation(): Int = className.hashCode() * 31 + noiseLocations++
+
     /**
      * Adds tracking indirect writes to exclude an object from local objects set if necessary.
      * To achieve it, we track [AtomicReferenceFieldUpdater], [Unsafe] and [VarHandle] write methods.
@@ -28,6 +28,7 @@ import java.lang.reflect.*
 import java.security.*
 import java.util.*
 import java.util.concurrent.*
+import java.util.concurrent.atomic.*
 import java.util.jar.*
 
 /**
@@ -49,6 +50,12 @@ internal enum class InstrumentationMode {
      */
     STRESS,
 
+    /**
+     * In this mode, Lincheck additionally injects randomized
+     * delays before shared memory accesses in the stress mode.
+     */
+    STRESS_WITH_NOISE,
+
     /**
      * In this mode, Lincheck tracks
      * all shared memory manipulations.
@@ -114,7 +121,7 @@ internal object LincheckJavaAgent {
         // processes classes lazily, only when they are used. However, we have an
         // option to enable the global transformation in the model checking mode
         // for testing purposes.
-        if (instrumentationMode == STRESS || INSTRUMENT_ALL_CLASSES_IN_MODEL_CHECKING_MODE) {
+        if (instrumentationMode != MODEL_CHECKING || INSTRUMENT_ALL_CLASSES_IN_MODEL_CHECKING_MODE) {
             // Re-transform the already loaded classes.
             // New classes will be transformed automatically.
             instrumentation.retransformClasses(*getLoadedClassesToInstrument().toTypedArray())
@@ -301,11 +308,20 @@ internal object LincheckClassFileTransformer : ClassFileTransformer {
      */
     private val transformedClassesModelChecking = ConcurrentHashMap<Any, ByteArray>()
     private val transformedClassesStress = ConcurrentHashMap<Any, ByteArray>()
+    private val transformedClassesStressWithNoise = ConcurrentHashMap<Any, ByteArray>()
     val nonTransformedClasses = ConcurrentHashMap<Any, ByteArray>()
 
+    /**
+     * The number of classes transformed since the start, and the total time spent on their transformation;
+     * the classes taken from the cache are not counted. The transformations may happen in parallel.
+     */
+    val transformedClassesCount = AtomicInteger()
+    val transformationTimeNanos = AtomicLong()
+
     private val transformedClassesCache
         get() = when (instrumentationMode) {
             STRESS -> transformedClassesStress
+            STRESS_WITH_NOISE -> transformedClassesStressWithNoise
             MODEL_CHECKING -> transformedClassesModelChecking
         }
 
@@ -324,6 +340,7 @@ internal object LincheckClassFileTransformer : ClassFileTransformer {
 
     private fun transformImpl(loader: ClassLoader?, className: String, classBytes: ByteArray): ByteArray = transformedClassesCache.computeIfAbsent(className) {
         nonTransformedClasses[className] = classBytes
+        val startTime = System.nanoTime()
         val reader = ClassReader(classBytes)
         val writer = SafeClassWriter(reader, loader, ClassWriter.COMPUTE_FRAMES)
         try {
@@ -333,6 +350,9 @@ internal object LincheckClassFileTransformer : ClassFileTransformer {
             System.err.println("Unable to transform $className")
             e.printStackTrace()
             classBytes
+        } finally {
+            transformedClassesCount.incrementAndGet()
+            transformationTimeNanos.addAndGet(System.nanoTime() - startTime)
         }
     }
 
@@ -340,7 +360,7 @@ internal object LincheckClassFileTransformer : ClassFileTransformer {
     fun shouldTransform(className: String, instrumentationMode: InstrumentationMode): Boolean {
         // In the stress testing mode, we can simply skip the standard
         // Java and Kotlin classes -- they do not have coroutine suspension points.
-        if (instrumentationMode == STRESS) {
+        if (instrumentationMode != MODEL_CHECKING) {
             if (className.startsWith("java.") || className.startsWith("kotlin.")) return false
         }
         // We do not need to instrument most standard Java classes.
@@ -10,9 +10,19 @@
 
 package org.jetbrains.kotlinx.lincheck.util
 
+import java.util.concurrent.locks.LockSupport
+
 /**
  * A spinner implements utility functions for spinning in a loop.
  *
+ * The spinner adapts to the typical waiting time of its call site:
+ * it keeps an exponential moving average of the number of spin-loop iterations
+ * the successful waits took, and bounds the spinning phase by a multiple of this average.
+ * When the spinning phase is exceeded, the waiting thread backs off
+ * by yielding and then by parking for exponentially increasing periods.
+ *
+ * A spinner is supposed to be used by a single thread, as its statistics are not synchronized.
+ *
  * @property nThreads If passed, denotes the number of threads in a group that
  *   may wait for a common condition in the spin-loop.
  *   This information is used to check if the number of available CPUs is greater than
@@ -30,6 +40,7 @@ internal class Spinner(val nThreads: Int = -1) {
      * and the number of threads (if provided in the constructor).
      * If the number of processors is less than the number of threads,
      * then the spinner should exit the loop immediately.
+     * Note that [Runtime.availableProcessors] takes the container CPU limits into account.
      */
     val shouldSpin: Boolean = run {
         val nProcessors = Runtime.getRuntime().availableProcessors()
@@ -37,21 +48,55 @@ internal class Spinner(val nThreads: Int = -1) {
     }
 
     /**
-     * Waits in the spin-loop until the given condition is true
-     * with periodical yielding to other threads.
+     * The exponential moving average of the number of spin-loop iterations
+     * which the successful waits in the spinning phase took.
+     */
+    @PublishedApi
+    internal var averageSpinCycles: Int = INITIAL_AVERAGE_SPIN_CYCLES
+
+    /**
+     * The current bound on the number of spin-loop iterations in the spinning phase.
+     */
+    val spinCyclesBound: Int get() =
+        if (shouldSpin) (averageSpinCycles * SPIN_BOUND_FACTOR).coerceIn(MIN_SPIN_CYCLES_BOUND, SPIN_CYCLES_BOUND) else 0
+
+    /**
+     * The total number of spin-loop iterations performed by this spinner.
+     */
+    var spinCount: Long = 0
+        @PublishedApi internal set
+
+    /**
+     * The total number of [Thread.yield] calls performed by this spinner.
+     */
+    var yieldCount: Long = 0
+        @PublishedApi internal set
+
+    /**
+     * The total number of parkings performed by this spinner.
+     */
+    var parkCount: Long = 0
+        @PublishedApi internal set
+
+    /**
+     * The number of waits which have not completed in the spinning phase.
+     */
+    var spinFailureCount: Long = 0
+        @PublishedApi internal set
+
+    /**
+     * Waits in the spin-loop until the given condition is true;
+     * if the condition is not satisfied in the spinning phase, backs off
+     * via periodical yielding to other threads, and then via parking.
      *
      * @param condition A lambda function that determines the condition to wait for.
      *   The function should return true when the condition is satisfied, and false otherwise.
      */
     inline fun spinWaitUntil(condition: () -> Boolean) {
-        var counter = 0
-        val yieldLimit = 1 + if (shouldSpin) SPIN_CYCLES_BOUND else 0
+        if (spinWaitBoundedUntil(condition)) return
+        var iteration = 0
         while (!condition()) {
-            Thread.onSpinWait()
-            counter++
-            if (counter % yieldLimit == 0) {
-                Thread.yield()
-            }
+            backoff(iteration++)
         }
     }
 
@@ -66,20 +111,54 @@ internal class Spinner(val nThreads: Int = -1) {
      * @return `true` if the condition is met; `false` if the condition was not met and
      *   the spin-wait loop exited because the bound was reached.
      */
-    inline fun Spinner.spinWaitBoundedUntil(condition: () -> Boolean): Boolean {
+    inline fun spinWaitBoundedUntil(condition: () -> Boolean): Boolean {
         var counter = 0
-        val exitLimit = if (shouldSpin) SPIN_CYCLES_BOUND else 0
-        var result = true
+        val exitLimit = spinCyclesBound
         while (!condition()) {
             if (counter == exitLimit) {
-                result = condition()
-                break
+                spinCount += counter
+                if (condition()) {
+                    onSpinSuccess(counter)
+                    return true
+                }
+                onSpinFailure()
+                return false
             }
             Thread.onSpinWait()
             counter++
         }
-        return result
+        spinCount += counter
+        onSpinSuccess(counter)
+        return true
     }
+
+    @PublishedApi
+    internal fun onSpinSuccess(cycles: Int) {
+        averageSpinCycles += (cycles - averageSpinCycles) shr EMA_SHIFT
+    }
+
+    @PublishedApi
+    internal fun onSpinFailure() {
+        spinFailureCount++
+        // The spinning has not helped, spin less next time.
+        averageSpinCycles -= averageSpinCycles shr EMA_SHIFT
+    }
+
+    // Yields first, then parks for exponentially increasing periods.
+    @PublishedApi
+    internal fun backoff(iteration: Int) {
+        if (iteration < YIELD_LIMIT) {
+            yieldCount++
+            Thread.yield()
+        } else {
+            parkCount++
+            val shift = (iteration - YIELD_LIMIT).coerceAtMost(MAX_PARK_SHIFT)
+            LockSupport.parkNanos(MIN_PARK_NANOS shl shift)
+        }
+    }
+
+    override fun toString() =
+        "Spinner(spinCyclesBound=$spinCyclesBound, spins=$spinCount, spinFailures=$spinFailureCount, yields=$yieldCount, parks=$parkCount)"
 }
 
 /**
@@ -94,13 +173,12 @@ internal class Spinner(val nThreads: Int = -1) {
  * @see Spinner.spinWaitBoundedFor
  */
 internal inline fun <T> Spinner.spinWaitBoundedFor(getter: () -> T?): T? {
+    var result: T? = null
     spinWaitBoundedUntil {
-        val result = getter()
-        if (result != null)
-            return result
-        false
+        result = getter()
+        result != null
     }
-    return null
+    return result
 }
 
 /**
@@ -114,5 +192,13 @@ internal fun SpinnerGroup(nThreads: Int): List<Spinner> {
     return Array(nThreads) { Spinner(nThreads) }.asList()
 }
 
+const val SPIN_CYCLES_BOUND: Int = 1_000_000
+
+private const val MIN_SPIN_CYCLES_BOUND = 1_000
+private const val INITIAL_AVERAGE_SPIN_CYCLES = SPIN_CYCLES_BOUND / 4
+private const val SPIN_BOUND_FACTOR = 4
+private const val EMA_SHIFT = 3 // the weight of a new sample is 1/8
 
-const val SPIN_CYCLES_BOUND: Int = 1_000_000
\ No newline at end of file
+private const val YIELD_LIMIT = 100
+private const val MIN_PARK_NANOS = 1_000L // 1 microsecond
+private const val MAX_PARK_SHIFT = 10 // ~1 millisecond
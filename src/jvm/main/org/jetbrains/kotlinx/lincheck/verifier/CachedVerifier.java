@@ -7,35 +7,69 @@
  * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
  * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
-
 package org.jetbrains.kotlinx.lincheck.verifier;
 
 import org.jetbrains.kotlinx.lincheck.execution.*;
 
 import java.util.*;
 
+import static org.jetbrains.kotlinx.lincheck.execution.ExecutionResultFingerprintKt.behaviourFingerprints;
+import static org.jetbrains.kotlinx.lincheck.execution.ExecutionResultFingerprintKt.getFingerprint;
+
 /**
  * This verifier cached the already verified results in a hash table,
  * and look into this hash table at first. In case of many invocations
  * with the same scenario, this optimization improves the verification
  * phase significantly.
+ *
+ * <p> The results are indexed by their 64-bit fingerprints, see {@link ResultFingerprintSet};
+ * a fingerprint match is always confirmed by comparing the results, as the fingerprints may collide.
+ * The number of cached results per scenario can be bounded via {@code -Dlincheck.verifier.maxCachedResults}.
  */
 public abstract class CachedVerifier implements Verifier {
-    private final Map<ExecutionScenario, Set<ExecutionResult>> previousResults = new WeakHashMap<>();
+    private static final int MAX_CACHED_RESULTS = Integer.getInteger("lincheck.verifier.maxCachedResults", Integer.MAX_VALUE);
+    private static final int MAX_OBSERVED_BEHAVIOURS = 1 << 20;
+
+    private final Map<ExecutionScenario, ResultFingerprintSet> previousResults = new WeakHashMap<>();
+    // The scenario-independent fingerprints of the correct behaviours, shared by all the scenarios.
+    private final Set<Long> observedBehaviours = new HashSet<>();
 
     @Override
     public boolean verifyResults(ExecutionScenario scenario, ExecutionResult results) {
-        Set<ExecutionResult> executionResults = previousResults.computeIfAbsent(scenario, s -> new HashSet<>());
-        if (executionResults.contains(results)) return true;
+        ResultFingerprintSet verifiedResults = previousResults.computeIfAbsent(scenario,
+            s -> new ResultFingerprintSet(MAX_CACHED_RESULTS));
+        long fingerprint = getFingerprint(results);
+        if (verifiedResults.contains(fingerprint, results::equals)) return true;
         boolean isValid = verifyResultsImpl(scenario, results);
         // We store in previousResults only correct executions.
         // Otherwise, as we re-use this verifier when doing replay in the Plugin, we could find incorrect execution
         // in this cache and indicate that incorrect result is correct.
         if (isValid) {
-            executionResults.add(results);
+            verifiedResults.add(fingerprint, results);
+            if (observedBehaviours.size() < MAX_OBSERVED_BEHAVIOURS) {
+                for (long behaviour : behaviourFingerprints(scenario, results)) observedBehaviours.add(behaviour);
+            }
         }
         return isValid;
     }
 
+    /**
+     * Checks whether the results with the specified fingerprint have already been verified as correct
+     * for this scenario, without materializing them; the {@code matcher} confirms fingerprint matches.
+     */
+    public boolean isVerified(ExecutionScenario scenario, long fingerprint, ResultFingerprintSet.ResultMatcher matcher) {
+        ResultFingerprintSet verifiedResults = previousResults.get(scenario);
+        return verifiedResults != null && verifiedResults.contains(fingerprint, matcher);
+    }
+
+    /**
+     * The number of distinct correct behaviours observed over all the scenarios: the operations with their results
+     * of a parallel thread, or of the init and post parts. As the behaviours do not depend on the scenario,
+     * the growth of this number indicates that the tested scenarios produce behaviours that have not been seen before.
+     */
+    public int getObservedBehavioursCount() {
+        return observedBehaviours.size();
+    }
+
     public abstract boolean verifyResultsImpl(ExecutionScenario scenario, ExecutionResult results);
 }
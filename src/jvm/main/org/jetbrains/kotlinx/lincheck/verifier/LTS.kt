@@ -12,10 +12,13 @@ package org.jetbrains.kotlinx.lincheck.verifier
 
 import kotlinx.coroutines.*
 import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.execution.*
 import org.jetbrains.kotlinx.lincheck.verifier.LTS.*
 import org.jetbrains.kotlinx.lincheck.verifier.OperationType.*
 import org.jetbrains.kotlinx.lincheck.transformation.LincheckJavaAgent
 import sun.nio.ch.lincheck.Injections.lastSuspendedCancellableContinuationDuringVerification
+import java.lang.reflect.Method
+import java.lang.reflect.Modifier
 import java.util.*
 import kotlin.coroutines.*
 import kotlin.math.*
@@ -41,26 +44,121 @@ typealias ResumedTickets = Set<Int>
  * "Nonblocking concurrent objects with condition synchronization" paper by Scherer III W., Scott M.
  *
  * Practically, Kotlin implementation of such operations via suspend functions is supported.
+ *
+ * By default, a new transition is computed by creating a fresh instance of the sequential specification
+ * and replaying the whole sequence of operations leading to the source state. If the sequential specification
+ * provides a public no-argument `copy()` or `clone()` method, the instance materialized for the source state
+ * is copied instead, so that each new transition costs a single operation invocation.
+ *
+ * Equivalent states are merged. If the sequential specification does not define `equals`,
+ * states without suspended and resumed operations are compared structurally (see [StateEquivalence]).
+ *
+ * The number of cached states is bounded by [maxStates], so that the same [LTS] can be reused
+ * across an arbitrary number of scenarios. When the bound is exceeded, states are evicted
+ * in the second-chance order: an evicted state drops its cached transitions and can no longer be reused,
+ * while the transitions leading to it are re-computed on the next request, re-deriving the state
+ * from its [State.seqToCreate] sequence. The initial state is never evicted.
  */
 
-class LTS(private val sequentialSpecification: Class<*>) {
+class LTS(
+    private val sequentialSpecification: Class<*>,
+    private val maxStates: Int = DEFAULT_MAX_LTS_STATES,
+    private val maxInternedActors: Int = DEFAULT_MAX_INTERNED_ACTORS
+) {
+    init {
+        require(maxStates > 0) { "The maximal number of LTS states should be positive, but $maxStates is specified" }
+        require(maxInternedActors > 0) { "The maximal number of interned actors should be positive, but $maxInternedActors is specified" }
+    }
+
     /**
      * Cache with all LTS states in order to reuse the equivalent ones.
      * Equivalency relation among LTS states is defined by the [StateInfo] class.
      */
     private val stateInfos = HashMap<StateInfo, StateInfo>()
 
+    /**
+     * Cached states in the order of their creation, used to choose the states to evict.
+     */
+    private val evictionQueue = ArrayDeque<StateInfo>()
+
+    /**
+     * The number of currently cached states.
+     */
+    val statesCount: Int get() = stateInfos.size
+
+    /**
+     * The number of currently cached transitions.
+     */
+    var transitionsCount: Int = 0
+        private set
+
+    /**
+     * The total number of evicted states.
+     */
+    var evictedStatesCount: Long = 0
+        private set
+
+    /**
+     * The method copying sequential specification instances, or `null` if it is not provided.
+     */
+    private val instanceCopier: Method? = findInstanceCopier(sequentialSpecification)
+
+    /**
+     * Defines the equivalence of sequential specification instances.
+     */
+    private val stateEquivalence = StateEquivalence(sequentialSpecification)
+
+    /**
+     * Actors interned into dense ids, which key the transitions by requests (see [internActors]).
+     */
+    private val actorIds = HashMap<Actor, Int>()
+    private val actors = ArrayList<Actor>()
+
+    /**
+     * The scenario whose actors were interned last, and their ids;
+     * verifiers check the same scenario many times in a row.
+     */
+    private var internedScenario: ExecutionScenario? = null
+    private var internedScenarioActorIds: Array<IntArray>? = null
+
+    /**
+     * Invokers of the operation methods, bound once and then reused for all the transitions and replays.
+     */
+    private val actorInvokers = HashMap<Method, ActorInvoker>()
+
     val initialState: State = createInitialState()
 
     /**
      * [LTS] state is defined by the sequence of operations that lead to this state from the [initialState].
      * Every state stores possible transitions([transitionsByRequests] and [transitionsByFollowUps]) by actors which are computed lazily
      * by the corresponding [next] requests ([nextByRequest] and [nextByFollowUp] respectively).
+     * Transitions by requests are keyed by actor ids (see [internActors]), while the other transitions are keyed by tickets.
      */
     inner class State(val seqToCreate: List<Operation>) {
-        internal val transitionsByRequests by lazy { mutableMapOf<Actor, TransitionInfo>() }
-        internal val transitionsByFollowUps by lazy { mutableMapOf<Int, TransitionInfo>() }
-        internal val transitionsByCancellations by lazy { mutableMapOf<Int, TransitionInfo>() }
+        /**
+         * The [LTS] this state belongs to.
+         */
+        internal val lts: LTS get() = this@LTS
+
+        /**
+         * The sequential specification instance corresponding to this state. It is never modified,
+         * and is stored only if the instance can be copied and no operation is suspended or resumed in this state.
+         */
+        internal var snapshot: Any? = null
+
+        /**
+         * Whether this state has been used since the last eviction pass.
+         */
+        internal var referenced = true
+
+        /**
+         * Whether this state has been evicted from the cache. Evicted states do not cache transitions.
+         */
+        internal var evicted = false
+
+        internal val transitionsByRequests = TransitionTable()
+        internal val transitionsByFollowUps = TransitionTable()
+        internal val transitionsByCancellations = TransitionTable()
         private val atomicallySuspendedAndCancelledTransition: TransitionInfo by lazy {
             createAtomicallySuspendedAndCancelledTransition()
         }
@@ -68,21 +166,32 @@ class LTS(private val sequentialSpecification: Class<*>) {
         /**
          * Computes or gets the existing transition from the current state by the given [actor].
          */
-        fun next(actor: Actor, expectedResult: Result, ticket: Int) = when(ticket) {
-            NO_TICKET -> nextByRequest(actor, expectedResult)
-            else -> nextByFollowUp(actor, ticket, expectedResult)
+        fun next(actor: Actor, expectedResult: Result, ticket: Int): TransitionInfo? =
+            next(actorId(actor), expectedResult, ticket)
+
+        /**
+         * Computes or gets the existing transition from the current state by the actor with the given id,
+         * see [internActors].
+         */
+        fun next(actorId: Int, expectedResult: Result, ticket: Int): TransitionInfo? {
+            referenced = true
+            val actor = actors[actorId]
+            return when(ticket) {
+                NO_TICKET -> nextByRequest(actorId, actor, expectedResult)
+                else -> nextByFollowUp(actor, ticket, expectedResult)
+            }.also { evictIfNeeded() }
         }
 
         private fun createAtomicallySuspendedAndCancelledTransition() =  copyAndApply { instance, suspendedOperations, resumedTicketsWithResults, continuationsMap ->
-            TransitionInfo(this, getResumedOperations(resumedTicketsWithResults).map { it.resumedActorTicket }.toSet(), NO_TICKET, null, Cancelled)
+            TransitionInfo(this, getResumedOperations(resumedTicketsWithResults).resumedTickets(), NO_TICKET, null, Cancelled)
         }
 
-        private fun nextByRequest(actor: Actor, expectedResult: Result): TransitionInfo? {
+        private fun nextByRequest(actorId: Int, actor: Actor, expectedResult: Result): TransitionInfo? {
             // Compute the transition following the sequential specification.
-            val transitionInfo = transitionsByRequests.computeIfAbsent(actor) { a ->
+            val transitionInfo = transitionsByRequests.getOrCompute(actorId) {
                 copyAndApply { instance, suspendedOperations, resumedTicketsWithResults, continuationsMap ->
                     val ticket = findFirstAvailableTicket(suspendedOperations, resumedTicketsWithResults)
-                    val op = Operation(a, ticket, REQUEST)
+                    val op = Operation(actor, ticket, REQUEST)
                     // Invoke the given operation to count the next transition.
                     val result = op.invoke(instance, suspendedOperations, resumedTicketsWithResults, continuationsMap)
                     createTransition(op, result, instance, suspendedOperations, getResumedOperations(resumedTicketsWithResults))
@@ -97,7 +206,7 @@ class LTS(private val sequentialSpecification: Class<*>) {
         }
 
         private fun nextByFollowUp(actor: Actor, ticket: Int, expectedResult: Result): TransitionInfo? {
-            val transitionInfo = transitionsByFollowUps.computeIfAbsent(ticket) {
+            val transitionInfo = transitionsByFollowUps.getOrCompute(ticket) {
                 copyAndApply { instance, suspendedOperations, resumedTicketsWithResults, continuationsMap ->
                     // Invoke the given operation to count the next transition.
                     val op = Operation(actor, ticket, FOLLOW_UP)
@@ -111,14 +220,50 @@ class LTS(private val sequentialSpecification: Class<*>) {
             return if (expectedResult.isLegalByFollowUp(transitionInfo, actor.allowExtraSuspension)) transitionInfo else null
         }
 
-        fun nextByCancellation(actor: Actor, ticket: Int): TransitionInfo = transitionsByCancellations.computeIfAbsent(ticket) {
-            copyAndApply { instance, suspendedOperations, resumedTicketsWithResults, continuationsMap ->
-                // Invoke the given operation to count the next transition.
-                val op = Operation(actor, ticket, CANCELLATION)
-                val result = op.invoke(instance, suspendedOperations, resumedTicketsWithResults, continuationsMap)
-                check(result === Cancelled)
-                createTransition(op, result, instance, suspendedOperations, getResumedOperations(resumedTicketsWithResults))
-            }
+        fun nextByCancellation(actor: Actor, ticket: Int): TransitionInfo {
+            referenced = true
+            return transitionsByCancellations.getOrCompute(ticket) {
+                copyAndApply { instance, suspendedOperations, resumedTicketsWithResults, continuationsMap ->
+                    // Invoke the given operation to count the next transition.
+                    val op = Operation(actor, ticket, CANCELLATION)
+                    val result = op.invoke(instance, suspendedOperations, resumedTicketsWithResults, continuationsMap)
+                    check(result === Cancelled)
+                    createTransition(op, result, instance, suspendedOperations, getResumedOperations(resumedTicketsWithResults))
+                }
+            }.also { evictIfNeeded() }
+        }
+
+        /**
+         * Gets the cached transition by the given [key] or computes it via [computeTransition].
+         * Transitions leading to evicted states are re-computed, so that the next state is cached again.
+         */
+        private inline fun TransitionTable.getOrCompute(key: Int, computeTransition: () -> TransitionInfo): TransitionInfo {
+            val cachedTransition = get(key)
+            if (cachedTransition != null && !cachedTransition.nextState.evicted) return cachedTransition
+            val transition = computeTransition()
+            // Evicted states are no longer reachable from the cache, so they re-compute transitions on each request.
+            if (!evicted && put(key, transition)) transitionsCount++
+            return transition
+        }
+
+        /**
+         * Drops the transitions by requests, as the actor ids they are keyed by are re-assigned.
+         */
+        internal fun clearTransitionsByRequests() {
+            transitionsCount -= transitionsByRequests.size
+            transitionsByRequests.clear()
+        }
+
+        /**
+         * Evicts this state, dropping its transitions and the materialized instance.
+         */
+        internal fun evict() {
+            evicted = true
+            snapshot = null
+            transitionsCount -= transitionsByRequests.size + transitionsByFollowUps.size + transitionsByCancellations.size
+            transitionsByRequests.clear()
+            transitionsByFollowUps.clear()
+            transitionsByCancellations.clear()
         }
 
         private fun Result.isLegalByRequest(transitionInfo: TransitionInfo, allowExtraSuspension: Boolean) =
@@ -144,13 +289,20 @@ class LTS(private val sequentialSpecification: Class<*>) {
                 continuationsMap: MutableMap<Operation, CancellableContinuation<*>>
             ) -> T
         ): T {
-            // Copy the state by sequentially applying operations from seqToCreate.
-            val instance = createInitialStateInstance()
             val suspendedOperations = mutableListOf<Operation>()
             val resumedTicketsWithResults = mutableMapOf<Int, ResumedResult>()
             val continuationsMap = mutableMapOf<Operation, CancellableContinuation<*>>()
-            try {
-                seqToCreate.forEach { it.invoke(instance, suspendedOperations, resumedTicketsWithResults, continuationsMap) }
+            val materializedInstance = snapshot
+            val instance = try {
+                if (materializedInstance != null) {
+                    // Copy the state by copying the already materialized instance.
+                    copyInstance(materializedInstance)
+                } else {
+                    // Copy the state by sequentially applying operations from seqToCreate.
+                    createInitialStateInstance().also { instance ->
+                        seqToCreate.forEach { it.invoke(instance, suspendedOperations, resumedTicketsWithResults, continuationsMap) }
+                    }
+                }
             } catch (e: Exception) {
                 throw  IllegalStateException(e)
             }
@@ -164,11 +316,12 @@ class LTS(private val sequentialSpecification: Class<*>) {
             suspendedActorWithTickets: List<Operation>,
             resumedOperations: List<ResumptionInfo>
         ): TransitionInfo {
-            val stateInfo = StateInfo(this, instance, suspendedActorWithTickets, resumedOperations)
+            val instanceKey = stateEquivalence.key(instance, canBeStructural = suspendedActorWithTickets.isEmpty() && resumedOperations.isEmpty())
+            val stateInfo = StateInfo(this, instance, instanceKey, suspendedActorWithTickets, resumedOperations)
             return stateInfo.intern(actorWithTicket) { nextStateInfo, rf ->
                 TransitionInfo(
                     nextState = nextStateInfo.state,
-                    resumedTickets = stateInfo.resumedOperations.map { it.resumedActorTicket }.toSet(),
+                    sortedResumedTickets = stateInfo.resumedOperations.resumedTickets(),
                     ticket = if (rf != null && result === Suspended) rf[actorWithTicket.ticket] else actorWithTicket.ticket,
                     rf = rf,
                     result = result
@@ -184,6 +337,42 @@ class LTS(private val sequentialSpecification: Class<*>) {
             // Ignore the order of resumption by sorting the list of resumptions.
             return resumedOperations.sortedBy { it.resumedActorTicket }
         }
+
+        // The resumptions are sorted by tickets, see [getResumedOperations].
+        private fun List<ResumptionInfo>.resumedTickets(): IntArray =
+            IntArray(size) { this[it].resumedActorTicket }
+    }
+
+    /**
+     * Interns all the actors of the [scenario], returning their ids for each thread;
+     * verifiers intern the scenario actors once and then request transitions by these ids.
+     *
+     * The ids are valid until the next call with another scenario: to keep the memory footprint bounded
+     * when the scenarios contain many distinct actors, the ids are re-assigned from scratch once
+     * more than [maxInternedActors] actors are interned, dropping the transitions by requests of all the states.
+     */
+    fun internActors(scenario: ExecutionScenario): Array<IntArray> {
+        if (scenario === internedScenario) return internedScenarioActorIds!!
+        if (actors.size > maxInternedActors) resetActorIds()
+        return Array(scenario.nThreads) { t ->
+            scenario.threads[t].let { actors -> IntArray(actors.size) { actorId(actors[it]) } }
+        }.also {
+            internedScenario = scenario
+            internedScenarioActorIds = it
+        }
+    }
+
+    private fun actorId(actor: Actor): Int = actorIds.getOrPut(actor) {
+        actors.add(actor)
+        actors.size - 1
+    }
+
+    private fun resetActorIds() {
+        actorIds.clear()
+        actors.clear()
+        internedScenario = null
+        internedScenarioActorIds = null
+        stateInfos.keys.forEach { it.state.clearTransitionsByRequests() }
     }
 
     private fun Operation.invoke(
@@ -195,7 +384,8 @@ class LTS(private val sequentialSpecification: Class<*>) {
         val prevResumedTickets = resumedOperations.keys.toMutableList()
         lastSuspendedCancellableContinuationDuringVerification = null
         val res = when (type) {
-            REQUEST -> executeActor(externalState, actor, Completion(ticket, actor, resumedOperations))
+            REQUEST -> actorInvokers.getOrPut(actor.method) { ActorInvoker(externalState.javaClass, actor.method) }
+                .invoke(externalState, actor, if (actor.isSuspendable) Completion(ticket, actor, resumedOperations) else null)
             FOLLOW_UP -> {
                 val (cont, suspensionPointRes) = resumedOperations[ticket]!!.contWithSuspensionPointRes
                 val finalRes = (
@@ -250,16 +440,42 @@ class LTS(private val sequentialSpecification: Class<*>) {
         } else {
             val newSeqToCreate = if (curOperation != null) this.state.seqToCreate + curOperation else emptyList()
             stateInfos[this] = this.also { it.state = State(newSeqToCreate) }
+            evictionQueue.addLast(this)
+            // `VerifierState.extractState()` is allowed to break the instance, so it cannot be copied afterwards.
+            if (instanceCopier != null && instance !is VerifierState && suspendedOperations.isEmpty() && resumedOperations.isEmpty()) {
+                state.snapshot = instance
+            }
             return block(stateInfos[this]!!, null)
         }
     }
 
+    /**
+     * Evicts states until the number of cached states does not exceed [maxStates].
+     * Following the second-chance policy, a state which was used since
+     * the previous pass is not evicted, but is moved to the end of the queue.
+     */
+    private fun evictIfNeeded() {
+        while (stateInfos.size > maxStates) {
+            val stateInfo = evictionQueue.pollFirst()
+            val state = stateInfo.state
+            if (state.referenced || state === initialState) {
+                state.referenced = false
+                evictionQueue.addLast(stateInfo)
+                continue
+            }
+            stateInfos.remove(stateInfo)
+            state.evict()
+            evictedStatesCount++
+        }
+    }
+
     private fun createInitialState(): State {
         val instance = createInitialStateInstance()
         val initialState = State(emptyList())
         return StateInfo(
             state = initialState,
             instance = instance,
+            instanceKey = stateEquivalence.key(instance, canBeStructural = true),
             suspendedOperations = emptyList(),
             resumedOperations = emptyList()
         ).intern(null) { _, _ -> initialState }
@@ -274,6 +490,8 @@ class LTS(private val sequentialSpecification: Class<*>) {
         }
     }
 
+    private fun copyInstance(instance: Any): Any = instanceCopier!!.invoke(instance)!!
+
     private fun StateInfo.computeRemappingFunction(old: StateInfo): RemappingFunction? {
         if (maxTicket == NO_TICKET) return null
         val rf = IntArray(maxTicket + 1) { NO_TICKET }
@@ -312,8 +530,8 @@ class LTS(private val sequentialSpecification: Class<*>) {
     }
 
     private fun StringBuilder.appendTransitions(state: State, visitedStates: IdentityHashMap<State, Unit>) {
-        state.transitionsByRequests.forEach { actor, transition ->
-            appendln("${state.hashCode()} -> ${transition.nextState.hashCode()} [ label=\"<R,$actor:${transition.result},${transition.ticket}>, rf=${transition.rf?.contentToString()}\" ]")
+        state.transitionsByRequests.forEach { actorId, transition ->
+            appendln("${state.hashCode()} -> ${transition.nextState.hashCode()} [ label=\"<R,${actors[actorId]}:${transition.result},${transition.ticket}>, rf=${transition.rf?.contentToString()}\" ]")
             if (visitedStates.put(transition.nextState, Unit) === null) appendTransitions(transition.nextState, visitedStates)
         }
         state.transitionsByFollowUps.forEach { ticket, transition ->
@@ -327,30 +545,42 @@ class LTS(private val sequentialSpecification: Class<*>) {
     }
 }
 
+/**
+ * Finds a public no-argument `copy()` or `clone()` method of the [sequentialSpecification] class,
+ * which returns a copy of the instance.
+ */
+private fun findInstanceCopier(sequentialSpecification: Class<*>): Method? =
+    sequentialSpecification.methods.find { m ->
+        (m.name == "copy" || m.name == "clone" && Cloneable::class.java.isAssignableFrom(sequentialSpecification)) &&
+        m.parameterCount == 0 && !Modifier.isStatic(m.modifiers) &&
+        m.returnType.isAssignableFrom(sequentialSpecification)
+    }
+
 /**
  * Defines equivalency relation among LTS states (see [LTS.State]).
  * Stores information about the state: corresponding test [instance], execution status of operations that were used to create the given [state].
  *
  * The following state properties were chosen to define the state equivalency:
- *   1. The test instance corresponding to the given state with `hashCode` and `equals` defined by the user.
+ *   1. The test instance corresponding to the given state, compared via the [instanceKey] (see [StateEquivalence]).
  *   2. The list of actor `requests` suspended on the LTS path to the [state]
  *   3. The set of pairs of resumed and the corresponding resuming actors.
  */
 private class StateInfo(
     var state: State,
     val instance: Any,
+    val instanceKey: Any,
     val suspendedOperations: List<Operation>,
     val resumedOperations: List<ResumptionInfo>
 ) {
     override fun equals(other: Any?): Boolean {
         if (other !is StateInfo) return false
-        return instance == other.instance &&
+        return instanceKey == other.instanceKey &&
             suspendedOperations.map { it.actor } == other.suspendedOperations.map { it.actor } &&
             resumedOperations == other.resumedOperations
     }
 
     override fun hashCode() = Objects.hash(
-        instance,
+        instanceKey,
         suspendedOperations.map { it.actor },
         resumedOperations
     )
@@ -457,21 +687,113 @@ enum class OperationType { REQUEST, FOLLOW_UP, CANCELLATION }
 // should be less than all tickets
 internal const val NO_TICKET = -1
 
+/**
+ * The default maximal number of states cached by [LTS],
+ * can be changed via the `lincheck.lts.maxStates` system property;
+ * malformed values are ignored.
+ */
+internal val DEFAULT_MAX_LTS_STATES = System.getProperty("lincheck.lts.maxStates")?.toIntOrNull()?.takeIf { it > 0 } ?: 100_000
+
+/**
+ * The default maximal number of actors interned by [LTS] before their ids are re-assigned, see [LTS.internActors].
+ */
+internal const val DEFAULT_MAX_INTERNED_ACTORS = 1 shl 16
+
+/**
+ * Transitions of an LTS state keyed by a non-negative integer, either an actor id or a ticket.
+ * It is a compact open-addressing hash table, so that its size is proportional
+ * to the number of transitions actually computed from the state.
+ */
+internal class TransitionTable {
+    private var keys: IntArray = EMPTY_KEYS
+    private var transitions: Array<TransitionInfo?> = EMPTY_TRANSITIONS
+
+    /**
+     * The number of stored transitions.
+     */
+    var size: Int = 0
+        private set
+
+    operator fun get(key: Int): TransitionInfo? {
+        if (size == 0) return null
+        val mask = keys.size - 1
+        var i = slot(key, mask)
+        while (true) {
+            val transition = transitions[i] ?: return null
+            if (keys[i] == key) return transition
+            i = (i + 1) and mask
+        }
+    }
+
+    /**
+     * Stores the [transition] by the given [key], returns `true` if there was no transition by this key before.
+     */
+    fun put(key: Int, transition: TransitionInfo): Boolean {
+        // Keep the load factor at most 1/2, so that the probe sequences are short.
+        if (2 * (size + 1) > keys.size) grow()
+        val mask = keys.size - 1
+        var i = slot(key, mask)
+        while (true) {
+            if (transitions[i] == null) {
+                keys[i] = key
+                transitions[i] = transition
+                size++
+                return true
+            }
+            if (keys[i] == key) {
+                transitions[i] = transition
+                return false
+            }
+            i = (i + 1) and mask
+        }
+    }
+
+    fun clear() {
+        keys = EMPTY_KEYS
+        transitions = EMPTY_TRANSITIONS
+        size = 0
+    }
+
+    fun forEach(action: (key: Int, transition: TransitionInfo) -> Unit) {
+        for (i in keys.indices) {
+            transitions[i]?.let { action(keys[i], it) }
+        }
+    }
+
+    private fun grow() {
+        val oldKeys = keys
+        val oldTransitions = transitions
+        val capacity = if (oldKeys.isEmpty()) 2 else 2 * oldKeys.size
+        keys = IntArray(capacity)
+        transitions = arrayOfNulls(capacity)
+        size = 0
+        for (i in oldKeys.indices) {
+            oldTransitions[i]?.let { put(oldKeys[i], it) }
+        }
+    }
+
+    // Fibonacci hashing spreads the dense keys over the table.
+    private fun slot(key: Int, mask: Int) = (key * -0x61c88647).let { it xor (it ushr 16) } and mask
+}
+
+private val EMPTY_KEYS = IntArray(0)
+private val EMPTY_TRANSITIONS = arrayOfNulls<TransitionInfo>(0)
+
 private data class ResumptionInfo(
     val resumedActor: Actor,
     val by: Actor,
     val resumedActorTicket: Int
 )
 
-class TransitionInfo(
+class TransitionInfo internal constructor(
     /**
      * The next LTS state.
      */
     val nextState: State,
     /**
-     * The set of tickets corresponding to resumed operation requests which follow-ups are available to be invoked.
+     * The sorted tickets corresponding to resumed operation requests which follow-ups are available to be invoked.
      */
-    val resumedTickets: ResumedTickets, // TODO inline class which contains either Int? or IntArray
+    internal val sortedResumedTickets: IntArray,
     /**
      * The ticket assigned to the transition operation.
      *
@@ -492,6 +814,14 @@ class TransitionInfo(
      */
     val result: Result
 ) {
+    constructor(nextState: State, resumedTickets: ResumedTickets, ticket: Int, rf: RemappingFunction?, result: Result) :
+        this(nextState, resumedTickets.sorted().toIntArray(), ticket, rf, result)
+
+    /**
+     * The set of tickets corresponding to resumed operation requests which follow-ups are available to be invoked.
+     */
+    val resumedTickets: ResumedTickets get() = sortedResumedTickets.toSet()
+
     /**
      * Returns `true` if the currently invoked operation is completed.
      */
@@ -0,0 +1,87 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.verifier;
+
+import org.jetbrains.kotlinx.lincheck.execution.*;
+
+/**
+ * An open-addressing hash set of execution results indexed by their
+ * 64-bit {@link ExecutionResultFingerprintKt#getFingerprint fingerprints}.
+ * The fingerprints are built from the {@code hashCode()} of the result values, so they may collide;
+ * thus, the results themselves are stored as well, and a fingerprint match is confirmed by the {@link ResultMatcher}.
+ *
+ * <p> This class is not thread-safe.
+ */
+public final class ResultFingerprintSet {
+    private static final long EMPTY = 0;
+
+    private final int maxSize;
+    private long[] fingerprints = new long[16];
+    private ExecutionResult[] results = new ExecutionResult[16];
+    private int size = 0;
+
+    /**
+     * @param maxSize the maximal number of stored results, the following ones are ignored.
+     */
+    public ResultFingerprintSet(int maxSize) {
+        this.maxSize = maxSize;
+    }
+
+    public boolean contains(long fingerprint, ResultMatcher matcher) {
+        long key = toKey(fingerprint);
+        int mask = fingerprints.length - 1;
+        for (int i = index(key, mask); fingerprints[i] != EMPTY; i = (i + 1) & mask) {
+            if (fingerprints[i] != key) continue;
+            if (matcher.matches(results[i])) return true;
+        }
+        return false;
+    }
+
+    public void add(long fingerprint, ExecutionResult result) {
+        if (size >= maxSize) return;
+        if (2 * (size + 1) > fingerprints.length) grow();
+        insert(toKey(fingerprint), result);
+        size++;
+    }
+
+    private void insert(long key, ExecutionResult result) {
+        int mask = fingerprints.length - 1;
+        int i = index(key, mask);
+        while (fingerprints[i] != EMPTY) i = (i + 1) & mask;
+        fingerprints[i] = key;
+        results[i] = result;
+    }
+
+    private void grow() {
+        long[] oldFingerprints = fingerprints;
+        ExecutionResult[] oldResults = results;
+        fingerprints = new long[oldFingerprints.length * 2];
+        results = new ExecutionResult[oldFingerprints.length * 2];
+        for (int i = 0; i < oldFingerprints.length; i++) {
+            if (oldFingerprints[i] != EMPTY) insert(oldFingerprints[i], oldResults[i]);
+        }
+    }
+
+    // Zero marks an empty slot.
+    private static long toKey(long fingerprint) {
+        return fingerprint == EMPTY ? 1 : fingerprint;
+    }
+
+    private static int index(long key, int mask) {
+        return (int) (key ^ (key >>> 32)) & mask;
+    }
+
+    /**
+     * Compares a representation of execution results with a stored {@link ExecutionResult}.
+     */
+    public interface ResultMatcher {
+        boolean matches(ExecutionResult result);
+    }
+}
@@ -25,6 +25,8 @@ public class SerializabilityVerifier(
     override fun verifyResults(scenario: ExecutionScenario, results: ExecutionResult) =
         super.verifyResults(scenario, results.withEmptyClocks)
 
+    override fun usesClocks() = false
+
     override fun verifyResultsImpl(scenario: ExecutionScenario, results: ExecutionResult) =
         linerizabilityVerifier.verifyResultsImpl(scenario.converted, results.converted)
 
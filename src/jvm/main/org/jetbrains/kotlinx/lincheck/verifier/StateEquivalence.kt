@@ -0,0 +1,146 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck.verifier
+
+import org.jetbrains.kotlinx.lincheck.annotations.StateFingerprint
+import org.jetbrains.kotlinx.lincheck.util.UnsafeHolder.UNSAFE
+import java.lang.reflect.Field
+import java.lang.reflect.Method
+import java.lang.reflect.Modifier
+import java.util.*
+
+/**
+ * Defines the equivalence of sequential specification instances, which [LTS] uses to merge states.
+ *
+ * If the sequential specification has a [StateFingerprint] function, its result defines the equivalence.
+ * Otherwise, if `equals` is overridden, the instances themselves are compared.
+ * Otherwise, the instances are compared structurally, see [StructuralFingerprint].
+ */
+internal class StateEquivalence(sequentialSpecification: Class<*>) {
+    private val fingerprintFunction: Method? = sequentialSpecification.methods
+        .filter { it.isAnnotationPresent(StateFingerprint::class.java) }
+        .also { require(it.size <= 1) { "At most one @StateFingerprint function is allowed, but ${it.map { m -> m.name }} are found" } }
+        .singleOrNull()
+        ?.also { require(it.parameterCount == 0) { "@StateFingerprint function ${it.name} should not have arguments" } }
+
+    private val isStructural = fingerprintFunction == null && !sequentialSpecification.overridesEquals
+
+    /**
+     * Returns the key which `equals` and `hashCode` define the equivalence of the given [instance].
+     * Structural comparison is used only if [canBeStructural] is `true`, otherwise
+     * the instance itself is returned, so it is compared by identity.
+     */
+    fun key(instance: Any, canBeStructural: Boolean): Any = when {
+        fingerprintFunction != null -> fingerprintFunction.invoke(instance) ?: NULL_FINGERPRINT
+        isStructural && canBeStructural -> StructuralFingerprint.of(instance) ?: instance
+        else -> instance
+    }
+}
+
+private val NULL_FINGERPRINT = Any()
+
+/**
+ * Canonical representation of an object graph: objects are enumerated in the breadth-first order
+ * following the fields, each object is represented by its class and the values of its fields,
+ * while references to other objects are replaced with their numbers. Thus, two fingerprints
+ * are equal if and only if the object graphs are isomorphic and have equal values.
+ *
+ * Objects which classes override `equals`, such as strings, boxed primitives, or standard collections,
+ * as well as enums and classes, are not traversed and are compared by `equals`.
+ */
+private class StructuralFingerprint(private val elements: Array<Any?>) {
+    private val hash = elements.contentHashCode()
+
+    override fun equals(other: Any?) =
+        other is StructuralFingerprint && hash == other.hash && elements.contentEquals(other.elements)
+
+    override fun hashCode() = hash
+
+    companion object {
+        /**
+         * Computes the fingerprint of the [root] object graph, or returns `null` if some fields cannot be read.
+         */
+        fun of(root: Any): StructuralFingerprint? = try {
+            val elements = ArrayList<Any?>()
+            val objects = ArrayList<Any>()
+            val numbers = IdentityHashMap<Any, Int>()
+            fun reference(value: Any?): Any? {
+                if (value == null || classLayouts.get(value.javaClass).isLeaf) return value
+                return ObjectNumber(numbers.getOrPut(value) { objects.add(value); objects.size - 1 })
+            }
+            reference(root)
+            var i = 0
+            while (i < objects.size) {
+                val obj = objects[i++]
+                val clazz = obj.javaClass
+                elements += clazz
+                if (clazz.isArray) {
+                    val length = java.lang.reflect.Array.getLength(obj)
+                    elements += length
+                    for (j in 0 until length) elements += reference(java.lang.reflect.Array.get(obj, j))
+                } else {
+                    val layout = classLayouts.get(clazz)
+                    for (f in layout.fields.indices) {
+                        elements += reference(layout.read(obj, f))
+                    }
+                }
+            }
+            StructuralFingerprint(elements.toTypedArray())
+        } catch (t: Throwable) {
+            null
+        }
+    }
+}
+
+private data class ObjectNumber(val number: Int)
+
+/**
+ * Cached instance fields of a class and its superclasses, along with their offsets.
+ */
+private class ClassLayout(clazz: Class<*>) {
+    val isLeaf: Boolean = clazz.isPrimitive || clazz.isEnum || clazz.overridesEquals ||
+        IDENTITY_LEAVES.any { it.isAssignableFrom(clazz) }
+
+    val fields: Array<Field> =
+        if (isLeaf || clazz.isArray) emptyArray()
+        else generateSequence(clazz) { it.superclass }
+            .flatMap { it.declaredFields.asSequence() }
+            .filter { !Modifier.isStatic(it.modifiers) }
+            .toList().toTypedArray()
+
+    private val offsets = LongArray(fields.size) { UNSAFE.objectFieldOffset(fields[it]) }
+
+    fun read(obj: Any, fieldIndex: Int): Any? {
+        val offset = offsets[fieldIndex]
+        return when (fields[fieldIndex].type) {
+            Boolean::class.javaPrimitiveType -> UNSAFE.getBoolean(obj, offset)
+            Byte::class.javaPrimitiveType -> UNSAFE.getByte(obj, offset)
+            Char::class.javaPrimitiveType -> UNSAFE.getChar(obj, offset)
+            Short::class.javaPrimitiveType -> UNSAFE.getShort(obj, offset)
+            Int::class.javaPrimitiveType -> UNSAFE.getInt(obj, offset)
+            Long::class.javaPrimitiveType -> UNSAFE.getLong(obj, offset)
+            Float::class.javaPrimitiveType -> UNSAFE.getFloat(obj, offset)
+            Double::class.javaPrimitiveType -> UNSAFE.getDouble(obj, offset)
+            else -> UNSAFE.getObject(obj, offset)
+        }
+    }
+}
+
+private val classLayouts = object : ClassValue<ClassLayout>() {
+    override fun computeValue(type: Class<*>) = ClassLayout(type)
+}
+
+/**
+ * Objects of these classes are compared by identity and are not traversed.
+ */
+private val IDENTITY_LEAVES = listOf(Class::class.java, ClassLoader::class.java, Thread::class.java, Method::class.java, Field::class.java)
+
+private val Class<*>.overridesEquals: Boolean get() =
+    !isArray && getMethod("equals", Any::class.java).declaringClass != Any::class.java
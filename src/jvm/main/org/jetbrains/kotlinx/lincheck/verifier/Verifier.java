@@ -27,4 +27,12 @@ public interface Verifier {
      * Returns {@code true} if results are possible, {@code false} otherwise.
      */
     boolean verifyResults(ExecutionScenario scenario, ExecutionResult results);
+
+    /**
+     * Returns {@code true} if this verifier uses the happens-before clocks of the parallel results
+     * (see {@link ResultWithClock#getClockOnStart()}); otherwise, the runner does not record them.
+     */
+    default boolean usesClocks() {
+        return true;
+    }
 }
@@ -30,9 +30,26 @@ class LinearizabilityVerifier(sequentialSpecification: Class<*>) : AbstractLTSVe
 }
 
 class LinearizabilityContext : VerifierContext {
-    constructor(scenario: ExecutionScenario, results: ExecutionResult, state: LTS.State) : super(scenario, results, state)
+    /**
+     * Ids of the scenario actors interned by [LTS], see [LTS.internActors].
+     * They are computed once per scenario and shared among all the contexts.
+     */
+    private val actorIds: Array<IntArray>
+
+    constructor(scenario: ExecutionScenario, results: ExecutionResult, state: LTS.State) : super(scenario, results, state) {
+        actorIds = state.lts.internActors(scenario)
+    }
+
     constructor(scenario: ExecutionScenario, results: ExecutionResult, state: LTS.State,
-                executed: IntArray, suspended: BooleanArray, tickets: IntArray) : super(scenario, results, state, executed, suspended, tickets)
+                executed: IntArray, suspended: BooleanArray, tickets: IntArray) : super(scenario, results, state, executed, suspended, tickets) {
+        actorIds = state.lts.internActors(scenario)
+    }
+
+    private constructor(scenario: ExecutionScenario, results: ExecutionResult, state: LTS.State,
+                        executed: IntArray, suspended: BooleanArray, tickets: IntArray,
+                        actorIds: Array<IntArray>) : super(scenario, results, state, executed, suspended, tickets) {
+        this.actorIds = actorIds
+    }
 
     override fun nextContext(threadId: Int): LinearizabilityContext? {
         if (isCompleted(threadId)) return null
@@ -56,7 +73,7 @@ class LinearizabilityContext : VerifierContext {
         }
         // Try to make a transition by the next actor from the current thread,
         // passing the ticket corresponding to the current thread.
-        return state.next(actor, expectedResult, tickets[threadId])?.createContext(threadId)
+        return state.next(actorIds[threadId][actorId], expectedResult, tickets[threadId])?.createContext(threadId)
     }
 
     // checks whether the transition does not violate the happens-before relation constructed on the clocks
@@ -84,7 +101,7 @@ class LinearizabilityContext : VerifierContext {
         // update "suspended" statuses
         nextSuspended[threadId] = result == Suspended
         for (tid in threads) {
-            if (nextTickets[tid] in resumedTickets) // note, that we have to use remapped tickets here!
+            if (nextTickets[tid] in sortedResumedTickets) // note, that we have to use remapped tickets here!
                 nextSuspended[tid] = false
         }
         // mark this step as "executed" if the operation was not suspended or is cancelled
@@ -96,7 +113,8 @@ class LinearizabilityContext : VerifierContext {
             results = results,
             executed = nextExecuted,
             suspended = nextSuspended,
-            tickets = nextTickets
+            tickets = nextTickets,
+            actorIds = actorIds
         )
     }
 }
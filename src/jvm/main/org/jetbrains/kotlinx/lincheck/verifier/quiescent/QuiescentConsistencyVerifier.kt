@@ -18,22 +18,101 @@ import kotlin.collections.ArrayList
 
 /**
  * This verifier tests for quiescent consistency.
- * Note that it does not support quiescent points.
- * Thus, it potentially does not find some bugs.
- * However, we believe that quiescent points do not occur
- * in practice while supporting them complicates the implementation.
+ *
+ * The parallel part of the history is partitioned at quiescent points ---
+ * the moments when, according to the [HBClock]-s, no operation is pending,
+ * so that every operation after the point starts after all the operations before it complete.
+ * Inside each segment, the operations marked with [QuiescentConsistent] can be reordered freely,
+ * while the other ones still respect the program order and the happens-before relation.
+ * The segments are checked one after another: the set of [LTS] states reachable at the end
+ * of a segment becomes the set of starting states for the next one, and the already visited
+ * search states are memoized, so that long histories do not blow up the search.
+ *
+ * Scenarios with suspendable operations are checked by moving each [QuiescentConsistent]
+ * operation to a separate thread and delegating to [LinearizabilityVerifier].
  */
-class QuiescentConsistencyVerifier(sequentialSpecification: Class<*>) : Verifier {
+class QuiescentConsistencyVerifier(sequentialSpecification: Class<*>) : CachedVerifier() {
     private val linearizabilityVerifier = LinearizabilityVerifier(sequentialSpecification)
     private val scenarioMapping: MutableMap<ExecutionScenario, ExecutionScenario> = WeakHashMap()
 
-    override fun verifyResults(scenario: ExecutionScenario, results: ExecutionResult): Boolean {
+    private val lts: LTS get() = linearizabilityVerifier.lts
+
+    override fun verifyResultsImpl(scenario: ExecutionScenario, results: ExecutionResult): Boolean {
+        if (scenario.hasSuspendableActors) return verifyConvertedResults(scenario, results)
+        var states = setOf(lts.initialState).nextBySequence(scenario.initExecution, results.initResults)
+        val actorIds = lts.internActors(scenario)
+        for (segment in quiescentSegments(scenario, results, actorIds)) {
+            if (states.isEmpty()) return false
+            states = segment.reachableStates(states)
+        }
+        return states.nextBySequence(scenario.postExecution, results.postResults).isNotEmpty()
+    }
+
+    private fun verifyConvertedResults(scenario: ExecutionScenario, results: ExecutionResult): Boolean {
         val convertedScenario = scenario.converted
         val convertedResults = results.convert(scenario, convertedScenario.nThreads)
         checkScenarioAndResultsAreSimilarlyConverted(convertedScenario, convertedResults)
         return linearizabilityVerifier.verifyResults(convertedScenario, convertedResults)
     }
 
+    private fun Set<LTS.State>.nextBySequence(actors: List<Actor>, results: List<Result?>): Set<LTS.State> =
+        actors.foldIndexed(this) { i, states, actor ->
+            // null result is not impossible here as if the execution has hung, we won't check its result
+            states.mapNotNullTo(HashSet<LTS.State>()) { it.next(actor, results[i]!!, NO_TICKET)?.nextState }
+        }
+
+    /**
+     * Splits the parallel part into the finest sequence of segments separated by quiescent points.
+     */
+    private fun quiescentSegments(
+        scenario: ExecutionScenario,
+        results: ExecutionResult,
+        actorIds: Array<IntArray>
+    ): List<QuiescentSegment> {
+        val sizes = IntArray(scenario.nThreads) { scenario.parallelExecution[it].size }
+        val segments = ArrayList<QuiescentSegment>()
+        var cut = IntArray(scenario.nThreads)
+        while (!cut.contentEquals(sizes)) {
+            val nextCut = nextQuiescentCut(cut, sizes, results)
+            segments += QuiescentSegment(scenario, results, actorIds, cut, nextCut)
+            cut = nextCut
+        }
+        return segments
+    }
+
+    /**
+     * Quiescent cuts are totally ordered, so the closest one is the
+     * smallest closure among the cuts extended by a single operation.
+     */
+    private fun nextQuiescentCut(from: IntArray, sizes: IntArray, results: ExecutionResult): IntArray {
+        var best: IntArray? = null
+        for (t in from.indices) {
+            if (from[t] == sizes[t]) continue
+            val cut = from.copyOf().also { it[t]++ }
+            cut.closeToQuiescent(sizes, results)
+            if (best == null || cut.sum() < best.sum()) best = cut
+        }
+        return best!!
+    }
+
+    /**
+     * Extends this cut until every operation after it starts after all the operations before it are completed.
+     */
+    private fun IntArray.closeToQuiescent(sizes: IntArray, results: ExecutionResult) {
+        var changed = true
+        while (changed) {
+            changed = false
+            for (t in indices) {
+                if (this[t] == sizes[t]) continue
+                val clock = results.parallelResultsWithClock[t][this[t]].clockOnStart
+                if (indices.any { i -> clock[i] < this[i] }) {
+                    this[t]++
+                    changed = true
+                }
+            }
+        }
+    }
+
     private val ExecutionScenario.converted: ExecutionScenario get() = scenarioMapping.computeIfAbsent(this) {
         val parallelExecutionConverted = ArrayList<MutableList<Actor>>()
         repeat(nThreads) {
@@ -101,7 +180,97 @@ class QuiescentConsistencyVerifier(sequentialSpecification: Class<*>) : Verifier
             }
         }
     }
- }
+}
+
+/**
+ * Operations of the parallel part between two consecutive quiescent cuts [from] and [to].
+ * Each operation stores the indices of the operations of this segment that must precede it.
+ * The operations are identified by the [scenarioActorIds] interned by [LTS], see [LTS.internActors].
+ */
+private class QuiescentSegment(
+    scenario: ExecutionScenario,
+    results: ExecutionResult,
+    scenarioActorIds: Array<IntArray>,
+    from: IntArray,
+    to: IntArray
+) {
+    private val actors = ArrayList<Actor>()
+    private val actorIds = ArrayList<Int>()
+    private val expectedResults = ArrayList<Result>()
+    private val predecessors = ArrayList<BitSet>()
+
+    init {
+        // index of the first operation of each thread inside this segment
+        val firstIndex = IntArray(from.size)
+        for (t in from.indices) {
+            firstIndex[t] = actors.size
+            // the init part precedes the parallel actors of the first thread only, see [ExecutionScenario.threads]
+            val offset = if (t == 0) scenario.initExecution.size else 0
+            for (actorId in from[t] until to[t]) {
+                actors += scenario.parallelExecution[t][actorId]
+                actorIds += scenarioActorIds[t][offset + actorId]
+                // null result is not impossible here as if the execution has hung, we won't check its result
+                expectedResults += results.parallelResultsWithClock[t][actorId].result!!
+            }
+        }
+        for (t in from.indices) {
+            for (actorId in from[t] until to[t]) {
+                val clock = results.parallelResultsWithClock[t][actorId].clockOnStart
+                val preds = BitSet()
+                if (!scenario.parallelExecution[t][actorId].isQuiescentConsistent) {
+                    for (i in from.indices) {
+                        // clocks are not always collected, so the program order is set explicitly
+                        val bound = if (i == t) actorId else minOf(clock[i], to[i])
+                        for (predId in from[i] until bound) {
+                            if (!scenario.parallelExecution[i][predId].isQuiescentConsistent)
+                                preds.set(firstIndex[i] + predId - from[i])
+                        }
+                    }
+                }
+                predecessors += preds
+            }
+        }
+    }
+
+    /**
+     * Returns all the states reachable from [initialStates] by executing all the operations of this segment.
+     */
+    fun reachableStates(initialStates: Set<LTS.State>): Set<LTS.State> {
+        val reachable = HashSet<LTS.State>()
+        val visited = HashSet<Pair<LTS.State, BitSet>>()
+        initialStates.forEach { explore(it, BitSet(actors.size), visited, reachable) }
+        return reachable
+    }
+
+    private fun explore(
+        state: LTS.State,
+        executed: BitSet,
+        visited: MutableSet<Pair<LTS.State, BitSet>>,
+        reachable: MutableSet<LTS.State>
+    ) {
+        if (!visited.add(state to executed)) return
+        if (executed.cardinality() == actors.size) {
+            reachable += state
+            return
+        }
+        for (i in actors.indices) {
+            if (executed[i] || !predecessors[i].isSubsetOf(executed)) continue
+            val transition = state.next(actorIds[i], expectedResults[i], NO_TICKET) ?: continue
+            val nextExecuted = (executed.clone() as BitSet).apply { set(i) }
+            explore(transition.nextState, nextExecuted, visited, reachable)
+        }
+    }
+
+    private fun BitSet.isSubsetOf(other: BitSet): Boolean {
+        var i = nextSetBit(0)
+        while (i >= 0) {
+            if (!other[i]) return false
+            i = nextSetBit(i + 1)
+        }
+        return true
+    }
+}
+
 
 private val Actor.isQuiescentConsistent: Boolean get() = method.isAnnotationPresent(QuiescentConsistent::class.java)
 
@@ -0,0 +1,74 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import org.junit.*
+import org.junit.Assert.*
+import java.util.concurrent.atomic.*
+
+class StatisticsTest {
+    private val counter = AtomicInteger()
+
+    @Operation
+    fun incAndGet() = counter.incrementAndGet()
+
+    @Operation
+    fun get() = counter.get()
+
+    @Test
+    fun testModelChecking() {
+        val statistics = collectStatistics(ModelCheckingOptions().iterations(5).invocationsPerIteration(100), this::class.java)
+        assertEquals(5, statistics.scenarios(ScenarioKind.GENERATED).size)
+        for (scenario in statistics.scenarios) {
+            assertTrue(scenario.invocationsCount in 1..100)
+            assertTrue(scenario.verificationsCount >= scenario.invocationsCount)
+            assertTrue(scenario.switchPointsCount > 0)
+            assertTrue(scenario.interleavingTreeSize > 0)
+            assertTrue(scenario.ltsStatesCount > 0)
+        }
+        assertTrue(statistics.runningTimeNanos >= statistics.scenarios.sumOf { it.runningTimeNanos })
+    }
+
+    @Test
+    fun testStress() {
+        val statistics = collectStatistics(StressOptions().iterations(5).invocationsPerIteration(100), this::class.java)
+        assertEquals(5, statistics.scenarios.size)
+        assertEquals(500L, statistics.invocationsCount)
+        for (scenario in statistics.scenarios) {
+            assertEquals(0L, scenario.switchPointsCount)
+            assertEquals(0, scenario.interleavingTreeSize)
+            assertTrue(scenario.verificationsCount > 0)
+        }
+    }
+
+    @Test
+    fun testFailedScenarioMinimization() {
+        val statistics = collectStatistics(ModelCheckingOptions(), IncorrectCounter::class.java)
+        assertTrue(statistics.scenarios(ScenarioKind.MINIMIZATION).isNotEmpty())
+    }
+
+    private fun collectStatistics(options: Options<*, *>, testClass: Class<*>): LincheckStatistics {
+        var statistics: LincheckStatistics? = null
+        options.statisticsListener { statistics = it }
+        LinChecker(testClass, options).checkImpl()
+        return statistics ?: error("The statistics listener has not been called")
+    }
+
+    class IncorrectCounter {
+        private var counter = 0
+
+        @Operation
+        fun incAndGet() = ++counter
+    }
+}
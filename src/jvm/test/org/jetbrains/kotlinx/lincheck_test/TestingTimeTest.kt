@@ -0,0 +1,65 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.*
+import org.junit.*
+import java.util.concurrent.atomic.*
+
+class TestingTimeTest : AbstractLincheckTest() {
+    private val counter = AtomicInteger()
+
+    @Operation
+    fun incAndGet() = counter.incrementAndGet()
+
+    @Operation
+    fun get() = counter.get()
+
+    override fun <O : Options<O, *>> O.customize() {
+        testingTimeInSeconds(1)
+    }
+
+    override fun extractState() = counter.get()
+
+    @Test
+    fun testCompletesWithinTestingTime() {
+        val start = System.currentTimeMillis()
+        val failure = ModelCheckingOptions()
+            .iterations(1_000_000)
+            .testingTimeInSeconds(1)
+            .checkImpl(this::class.java)
+        assert(failure == null) { "The test should not fail:\n$failure" }
+        // Only the last scenario can exceed the testing time, by at most its planned time.
+        assert(System.currentTimeMillis() - start < 10_000) { "The testing time has been significantly exceeded" }
+    }
+}
+
+class IncorrectTestingTimeTest : AbstractLincheckTest(IncorrectResultsFailure::class) {
+    private var counter = 0
+
+    @Operation
+    fun incAndGet(): Int {
+        val value = counter
+        counter = value + 1
+        return value + 1
+    }
+
+    @Operation
+    fun get() = counter
+
+    override fun <O : Options<O, *>> O.customize() {
+        testingTimeInSeconds(5)
+    }
+
+    override fun extractState() = counter
+}
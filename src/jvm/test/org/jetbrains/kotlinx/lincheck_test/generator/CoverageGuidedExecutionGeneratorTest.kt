@@ -0,0 +1,73 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+package org.jetbrains.kotlinx.lincheck_test.generator
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.*
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.paramgen.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import org.jetbrains.kotlinx.lincheck.verifier.linearizability.*
+import org.junit.Assert.*
+import org.junit.Test
+
+/**
+ * Checks that [CoverageGuidedExecutionGenerator] adds a scenario to the corpus
+ * only if it has produced behaviours that have not been observed in the previous scenarios.
+ */
+class CoverageGuidedExecutionGeneratorTest {
+    @Test
+    fun testCorpusStopsGrowingWithoutNewBehaviours() {
+        // Each thread performs 1..3 `get()`-s returning 0, and the init and post parts have 0..2 operations;
+        // thus, there are only 3 distinct thread behaviours and 9 distinct behaviours of the init and post parts.
+        val corpusSize = corpusSizeAfterScenarios(Constant::class.java) { ValueResult(0) }
+        assertTrue("The corpus should contain at most 12 scenarios, but it contains $corpusSize", corpusSize <= 12)
+    }
+
+    @Test
+    fun testCorpusGrowsWithNewBehaviours() {
+        val corpusSize = corpusSizeAfterScenarios(Echo::class.java) { ValueResult(it.arguments[0]) }
+        assertTrue("The corpus should contain more than 12 scenarios, but it contains $corpusSize", corpusSize > 12)
+    }
+
+    private fun corpusSizeAfterScenarios(testClass: Class<*>, result: (Actor) -> Result): Int {
+        val testCfg = StressOptions()
+            .threads(2)
+            .actorsPerThread(3)
+            .actorsBefore(2)
+            .actorsAfter(2)
+            .createTestConfigurations(testClass)
+        val testStructure = CTestStructure.getFromTestClass(testClass)
+        val generator = CoverageGuidedExecutionGenerator(testCfg, testStructure, testStructure.randomProvider)
+        val verifier = LinearizabilityVerifier(testClass)
+        repeat(300) {
+            val scenario = generator.nextExecution()
+            val results = ExecutionResult(
+                scenario.initExecution.map(result),
+                scenario.parallelExecution.map { actors -> actors.map { ResultWithClock(result(it), emptyClock(scenario.nThreads)) } },
+                scenario.postExecution.map(result)
+            )
+            assertTrue(verifier.verifyResults(scenario, results))
+            generator.onScenarioTested(scenario, verifier)
+        }
+        return generator.corpusSize
+    }
+
+    class Constant {
+        @Operation
+        fun get() = 0
+    }
+
+    class Echo {
+        @Operation
+        fun echo(@Param(gen = IntGen::class, conf = "1:1000") value: Int) = value
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+package org.jetbrains.kotlinx.lincheck_test.generator
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.annotations.Param
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.paramgen.*
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import org.junit.Assert.*
+import org.junit.Test
+import java.util.concurrent.atomic.*
+
+class ExhaustiveExecutionGeneratorTest {
+    @Operation
+    fun a() = 0
+
+    @Operation
+    fun b() = 0
+
+    @Test
+    fun testSingleActorScenarios() {
+        // {a | a}, {a | b}, and {b | b}
+        assertEquals(3, generateAll(actorsPerThread = 1).size)
+    }
+
+    @Test
+    fun testScenariosUpToTwoActors() {
+        // There are 6 possible threads: a, b, aa, ab, ba, and bb; thus, 6 * 7 / 2 non-equivalent scenarios.
+        val scenarios = generateAll(actorsPerThread = 2)
+        assertEquals(21, scenarios.size)
+        assertEquals(21, scenarios.map { s -> s.parallelExecution.map { it.toString() }.sorted() }.toSet().size)
+    }
+
+    @Test
+    fun testSmallerScenariosFirst() {
+        val scenarios = generateAll(actorsPerThread = 2, actorsBefore = 1, actorsAfter = 1)
+        val sizes = scenarios.map { it.size }
+        assertEquals(sizes.sorted(), sizes)
+        // The parallel part varies first: {a | a}, {a | b}, and {b | b} are the first scenarios.
+        assertEquals(3, scenarios.take(3).map { s -> s.parallelExecution.map { it.toString() } }.toSet().size)
+        assertTrue(scenarios.take(3).all { it.initExecution.isEmpty() && it.postExecution.isEmpty() })
+        assertEquals(scenarios.size, scenarios.map { it.toString() }.toSet().size)
+    }
+
+    @Test(timeout = 10_000)
+    fun testLargeBoundsAreEnumeratedLazily() {
+        // 16 operations with arguments; all the sequences of 5 operations would not fit in the memory.
+        val generator = generator(ManyOperations::class.java, threads = 3, actorsPerThread = 5, actorsBefore = 5, actorsAfter = 5)
+        repeat(1000) {
+            assertTrue(generator.nextExecution().isValid)
+        }
+    }
+
+    @Test
+    fun testCancellationAndThreadIds() {
+        val scenarios = generateAll(CancellableOperations::class.java, actorsPerThread = 1, actorsAfter = 1)
+        val parallelActors = scenarios.flatMap { s -> s.parallelExecution.flatten() }
+        assertTrue(parallelActors.any { it.cancelOnSuspension && !it.promptCancellation })
+        assertTrue(parallelActors.any { it.promptCancellation })
+        assertTrue(parallelActors.any { !it.cancelOnSuspension })
+        // The post part is executed by the thread with the same id as in RandomExecutionGenerator.
+        val postActors = scenarios.flatMap { it.postExecution }
+        assertTrue(postActors.isNotEmpty())
+        assertTrue(postActors.all { it.arguments == listOf(3) })
+    }
+
+    private val ExecutionScenario.size: Int
+        get() = initExecution.size + parallelExecution.sumOf { it.size } + postExecution.size
+
+    private fun generateAll(actorsPerThread: Int, actorsBefore: Int = 0, actorsAfter: Int = 0) =
+        generateAll(this::class.java, actorsPerThread, actorsBefore, actorsAfter)
+
+    private fun generateAll(testClass: Class<*>, actorsPerThread: Int, actorsBefore: Int = 0, actorsAfter: Int = 0): List<ExecutionScenario> {
+        val generator = generator(testClass, threads = 2, actorsPerThread, actorsBefore, actorsAfter)
+        val scenarios = ArrayList<ExecutionScenario>()
+        while (generator.hasNextExecution()) {
+            scenarios += generator.nextExecution().also { assertTrue(it.isValid) }
+        }
+        return scenarios
+    }
+
+    private fun generator(testClass: Class<*>, threads: Int, actorsPerThread: Int, actorsBefore: Int, actorsAfter: Int): ExecutionGenerator {
+        val testCfg = StressOptions()
+            .threads(threads)
+            .actorsPerThread(actorsPerThread)
+            .actorsBefore(actorsBefore)
+            .actorsAfter(actorsAfter)
+            .createTestConfigurations(testClass)
+        val testStructure = CTestStructure.getFromTestClass(testClass)
+        return ExhaustiveExecutionGenerator(testCfg, testStructure, testStructure.randomProvider)
+    }
+
+    class ManyOperations {
+        @Operation fun op1(x: Int) = x
+        @Operation fun op2(x: Int) = x
+        @Operation fun op3(x: Int) = x
+        @Operation fun op4(x: Int) = x
+        @Operation fun op5(x: Int) = x
+        @Operation fun op6(x: Int) = x
+        @Operation fun op7(x: Int) = x
+        @Operation fun op8(x: Int) = x
+    }
+
+    class CancellableOperations {
+        @Operation(cancellableOnSuspension = true, promptCancellation = true)
+        suspend fun suspendable(@Param(gen = ThreadIdGen::class) threadId: Int) = threadId
+
+        @Operation
+        fun threadId(@Param(gen = ThreadIdGen::class) threadId: Int) = threadId
+    }
+}
+
+class ExhaustiveModelCheckingTest {
+    private var counter = 0
+
+    @Operation
+    fun inc() = ++counter
+
+    @Test
+    fun testBugIsFoundInSmallScope() {
+        val failure = ModelCheckingOptions()
+            .executionGenerator(ExhaustiveExecutionGenerator::class.java)
+            .iterations(Int.MAX_VALUE) // stops when all the scenarios are enumerated
+            .threads(2)
+            .actorsPerThread(1)
+            .actorsBefore(0)
+            .actorsAfter(0)
+            .invocationsPerIteration(100)
+            .checkImpl(this::class.java)
+        assertTrue("IncorrectResultsFailure is expected, but $failure is found", failure is IncorrectResultsFailure)
+    }
+
+    @Test
+    fun testScenarioSpaceExhaustionIsReported() {
+        // {inc | inc}, {inc | get}, and {get | get}
+        assertEquals(true, scenarioSpaceExhausted(CorrectCounter::class.java, iterations = 3))
+        assertEquals(false, scenarioSpaceExhausted(CorrectCounter::class.java, iterations = 2))
+    }
+
+    private fun scenarioSpaceExhausted(testClass: Class<*>, iterations: Int): Boolean? {
+        var statistics: LincheckStatistics? = null
+        val options = StressOptions()
+            .executionGenerator(ExhaustiveExecutionGenerator::class.java)
+            .iterations(iterations)
+            .threads(2)
+            .actorsPerThread(1)
+            .actorsBefore(0)
+            .actorsAfter(0)
+            .invocationsPerIteration(10)
+            .statisticsListener { statistics = it }
+        LinChecker(testClass, options).checkImpl()
+        return statistics!!.scenarioSpaceExhausted
+    }
+
+    class CorrectCounter {
+        private val counter = AtomicInteger()
+
+        @Operation
+        fun inc() = counter.incrementAndGet()
+
+        @Operation
+        fun get() = counter.get()
+    }
+}
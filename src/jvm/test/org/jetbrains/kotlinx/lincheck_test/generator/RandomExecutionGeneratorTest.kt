@@ -0,0 +1,90 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+package org.jetbrains.kotlinx.lincheck_test.generator
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.annotations.Param
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.paramgen.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import org.junit.Assert.*
+import org.junit.Test
+
+class RandomExecutionGeneratorTest {
+    @Operation
+    fun a() = 0
+
+    @Operation
+    fun b() = 0
+
+    @Test
+    fun testEquivalentScenariosAreNotRepeated() {
+        // There are only three non-equivalent scenarios: {a | a}, {a | b}, and {b | b}.
+        val testCfg = StressOptions()
+            .threads(2)
+            .actorsPerThread(1)
+            .actorsBefore(0)
+            .actorsAfter(0)
+            .createTestConfigurations(this::class.java)
+        val testStructure = CTestStructure.getFromTestClass(this::class.java)
+        val generator = RandomExecutionGenerator(testCfg, testStructure, testStructure.randomProvider)
+        val first = generator.nextExecution().parallelExecution.toSortedThreads()
+        val second = generator.nextExecution().parallelExecution.toSortedThreads()
+        assertNotEquals(first, second)
+        // When all the scenarios have been generated, the generator still produces them.
+        repeat(10) {
+            assertTrue(generator.nextExecution().isValid)
+        }
+    }
+
+    @Test
+    fun testThreadIdArgumentsInEquivalentScenarios() {
+        val testCfg = StressOptions().threads(2).createTestConfigurations(ThreadIdOperations::class.java)
+        val testStructure = CTestStructure.getFromTestClass(ThreadIdOperations::class.java)
+        val generator = MarkingGenerator(testCfg, testStructure)
+        assertTrue(generator.markGenerated(scenario {
+            parallel {
+                thread { actor(ThreadIdOperations::threadId, 1) }
+                thread { actor(ThreadIdOperations::value, 1) }
+            }
+        }))
+        // The same threads in the swapped order pass their own ids.
+        assertFalse(generator.markGenerated(scenario {
+            parallel {
+                thread { actor(ThreadIdOperations::value, 1) }
+                thread { actor(ThreadIdOperations::threadId, 2) }
+            }
+        }))
+        // The other arguments are compared as is.
+        assertTrue(generator.markGenerated(scenario {
+            parallel {
+                thread { actor(ThreadIdOperations::value, 2) }
+                thread { actor(ThreadIdOperations::threadId, 1) }
+            }
+        }))
+    }
+
+    private fun List<List<Actor>>.toSortedThreads() = map { it.toString() }.sorted()
+
+    private class MarkingGenerator(testCfg: CTestConfiguration, testStructure: CTestStructure) :
+        RandomExecutionGenerator(testCfg, testStructure, testStructure.randomProvider) {
+        public override fun markGenerated(scenario: ExecutionScenario) = super.markGenerated(scenario)
+    }
+
+    class ThreadIdOperations {
+        @Operation
+        fun threadId(@Param(gen = ThreadIdGen::class) threadId: Int) = threadId
+
+        @Operation
+        fun value(value: Int) = value
+    }
+}
@@ -11,11 +11,13 @@ package org.jetbrains.kotlinx.lincheck_test.representation
 
 import org.jetbrains.kotlinx.lincheck.annotations.Operation
 import org.jetbrains.kotlinx.lincheck.annotations.StateRepresentation
+import org.jetbrains.kotlinx.lincheck.annotations.Validate
 import org.jetbrains.kotlinx.lincheck.appendFailure
 import org.jetbrains.kotlinx.lincheck.checkImpl
 import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.ModelCheckingOptions
 import org.jetbrains.kotlinx.lincheck.strategy.stress.*
 import org.jetbrains.kotlinx.lincheck.strategy.IncorrectResultsFailure
+import org.jetbrains.kotlinx.lincheck.strategy.ValidationFailure
 import org.jetbrains.kotlinx.lincheck_test.util.*
 import org.jetbrains.kotlinx.lincheck.verifier.VerifierState
 import org.junit.Test
@@ -86,6 +88,37 @@ class StressStateReportingTest : VerifierState() {
 
 class StateRepresentationInParentClassTest : ModelCheckingStateReportingTest()
 
+/**
+ * This test checks that states are reported by the model checking strategy
+ * for failures other than incorrect results, here a validation failure.
+ */
+class ModelCheckingValidationFailureStateReportingTest {
+    private val counter = AtomicInteger(0)
+
+    @Operation
+    fun operation() = counter.incrementAndGet()
+
+    @Validate
+    fun validate() = check(counter.get() < 2) { "The counter should not exceed 1" }
+
+    @StateRepresentation
+    fun stateRepresentation() = counter.toString()
+
+    @Test
+    fun test() {
+        val options = ModelCheckingOptions()
+            .actorsPerThread(1)
+            .actorsBefore(0)
+            .actorsAfter(0)
+        val failure = options.checkImpl(this::class.java)
+        check(failure is ValidationFailure) { "Validation failure is expected, but $failure found." }
+        check(failure.results.afterInitStateRepresentation == "0")
+        check(failure.results.afterParallelStateRepresentation == "2")
+        check(failure.results.afterPostStateRepresentation == "2")
+        check("STATE: 2" in StringBuilder().appendFailure(failure).toString())
+    }
+}
+
 class TwoStateRepresentationFunctionsTest : VerifierState() {
     @Volatile
     private var counter = 0
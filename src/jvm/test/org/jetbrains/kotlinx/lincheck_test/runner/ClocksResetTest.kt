@@ -0,0 +1,78 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.runner
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.CTestConfiguration.Companion.DEFAULT_TIMEOUT_MS
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.runner.*
+import org.jetbrains.kotlinx.lincheck.runner.UseClocks.*
+import org.junit.*
+import org.junit.Assert.*
+import java.util.concurrent.atomic.*
+
+/**
+ * Checks that the invocations without clocks, which follow the invocations with clocks,
+ * do not expose stale clock values: the clocks in the [ParallelThreadsRunner]'s result buffer,
+ * which are fingerprinted and compared without materializing the results, should be
+ * the same as in the materialized results, where the unused clocks are always empty.
+ */
+class ClocksResetTest {
+    private val counter = AtomicInteger()
+
+    fun incAndGet() = counter.incrementAndGet()
+
+    private val scenario = scenario {
+        parallel {
+            thread {
+                actor(::incAndGet)
+                actor(::incAndGet)
+            }
+            thread {
+                actor(::incAndGet)
+                actor(::incAndGet)
+            }
+        }
+    }
+
+    @Test
+    fun testNoStaleClocks() = checkNoStaleClocks(lockstep = false)
+
+    @Test
+    fun testNoStaleClocksInLockstepBatches() = checkNoStaleClocks(lockstep = true)
+
+    private fun checkNoStaleClocks(lockstep: Boolean) {
+        var withClocks = 0
+        var withoutClocks = 0
+        ParallelThreadsRunner(
+            strategy = mockStrategy(scenario), testClass = this::class.java, validationFunction = null,
+            stateRepresentationFunction = null, timeoutMs = DEFAULT_TIMEOUT_MS, useClocks = RANDOM
+        ).use { runner ->
+            runner.runInLockstep = lockstep
+            repeat(200) {
+                val result = runner.run()
+                check(result is CompletedInvocationResult)
+                for (instance in 0 until runner.completedInstancesCount) {
+                    val instanceResult = if (instance == 0) result else runner.selectInstanceResults(instance)
+                    val buffer = instanceResult.buffer!!
+                    val results = instanceResult.results
+                    assertEquals(results.fingerprint, buffer.fingerprint())
+                    assertTrue(buffer.matches(results))
+                    results.parallelResultsWithClock.forEach { threadResults ->
+                        if (threadResults.any { !it.clockOnStart.empty }) withClocks++ else withoutClocks++
+                    }
+                }
+            }
+        }
+        // The clocks are used with probability 1/2 for each thread.
+        assertTrue(withClocks > 0)
+        assertTrue(withoutClocks > 0)
+    }
+}
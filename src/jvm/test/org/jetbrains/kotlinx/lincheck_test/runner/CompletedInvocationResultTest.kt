@@ -0,0 +1,62 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.runner
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.CTestConfiguration.Companion.DEFAULT_TIMEOUT_MS
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.runner.*
+import org.jetbrains.kotlinx.lincheck.runner.UseClocks.*
+import org.junit.*
+import org.junit.Assert.*
+
+/**
+ * Checks that the results of a [CompletedInvocationResult] returned by [ParallelThreadsRunner],
+ * which are stored in the runner's reusable buffer, are never replaced by the results of the next invocation.
+ */
+class CompletedInvocationResultTest {
+    private var counter = 0
+
+    @Operation
+    fun incAndGet() = ++counter
+
+    private val scenario = scenario {
+        parallel {
+            thread { actor(::incAndGet) }
+        }
+    }
+
+    @Test
+    fun testResultsReadBeforeNextInvocationAreKept() = withRunner { runner ->
+        val first = runner.run() as CompletedInvocationResult
+        val firstResults = first.results
+        val second = runner.run() as CompletedInvocationResult
+        assertNotSame(first, second)
+        assertSame(firstResults, first.results)
+        assertEquals(ValueResult(1), first.results.parallelResultsWithClock[0][0].result)
+        assertEquals(ValueResult(1), second.results.parallelResultsWithClock[0][0].result)
+    }
+
+    @Test(expected = IllegalStateException::class)
+    fun testResultsNotReadBeforeNextInvocationAreRejected() = withRunner { runner ->
+        val first = runner.run() as CompletedInvocationResult
+        runner.run()
+        first.results
+    }
+
+    private fun withRunner(block: (ParallelThreadsRunner) -> Unit) {
+        ParallelThreadsRunner(
+            strategy = mockStrategy(scenario), testClass = this::class.java, validationFunction = null,
+            stateRepresentationFunction = null, timeoutMs = DEFAULT_TIMEOUT_MS, useClocks = NEVER
+        ).use { runner ->
+            block(runner)
+        }
+    }
+}
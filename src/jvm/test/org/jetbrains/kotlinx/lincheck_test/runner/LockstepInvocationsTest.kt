@@ -0,0 +1,128 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.runner
+
+import kotlinx.coroutines.channels.*
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.CTestConfiguration.Companion.DEFAULT_TIMEOUT_MS
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.runner.*
+import org.jetbrains.kotlinx.lincheck.runner.UseClocks.*
+import org.junit.*
+import org.junit.Assert.*
+import java.util.concurrent.atomic.*
+
+/**
+ * Checks that [ParallelThreadsRunner] executes batches of lockstep invocations,
+ * each on a fresh test instance, and reports the results of every batched invocation.
+ */
+class LockstepInvocationsTest {
+    private val instanceId = createdInstances.incrementAndGet()
+    private val counter = AtomicInteger()
+    private val channel = Channel<Int>()
+
+    fun incAndGet() = counter.incrementAndGet()
+
+    fun validate() = check(instanceId != failingInstance)
+
+    suspend fun send(value: Int) = channel.send(value)
+
+    suspend fun receive() = channel.receive()
+
+    @Test
+    fun testBatchedInvocationsUseFreshInstances() {
+        val scenario = scenario {
+            initial { actor(::incAndGet) }
+            parallel {
+                thread { actor(::incAndGet) }
+                thread { actor(::incAndGet) }
+            }
+            post { actor(::incAndGet) }
+        }
+        withLockstepRunner(scenario, validationFunction = null) { runner ->
+            warmUpBatches(runner)
+            val createdInstancesBefore = createdInstances.get()
+            val result = runner.run()
+            check(result is CompletedInvocationResult)
+            val invocations = runner.lastRunInvocationsCount
+            assertTrue(invocations > 1)
+            assertEquals(invocations, runner.completedInstancesCount)
+            assertEquals(createdInstancesBefore + invocations, createdInstances.get())
+            for (k in 0 until invocations) {
+                val results = (if (k == 0) result else runner.selectInstanceResults(k)).results
+                assertEquals(ValueResult(1), results.initResults.single())
+                assertEquals(setOf(ValueResult(2), ValueResult(3)), results.parallelResultsWithClock.map { it.single().result }.toSet())
+                assertEquals(ValueResult(4), results.postResults.single())
+            }
+        }
+    }
+
+    @Test
+    fun testValidationFailureStopsBatch() {
+        val scenario = scenario {
+            parallel {
+                thread { actor(::incAndGet) }
+                thread { actor(::incAndGet) }
+            }
+        }
+        withLockstepRunner(scenario, validationFunction = actor(LockstepInvocationsTest::validate)) { runner ->
+            warmUpBatches(runner)
+            // The second invocation of the next batch fails.
+            failingInstance = createdInstances.get() + 2
+            val result = runner.run()
+            assertTrue("ValidationFailureInvocationResult is expected, but $result is found", result is ValidationFailureInvocationResult)
+            assertEquals(2, runner.lastRunInvocationsCount)
+        }
+    }
+
+    @Test
+    fun testSuspendableScenarioIsNotBatched() {
+        val scenario = scenario {
+            parallel {
+                thread { actor(LockstepInvocationsTest::send, 1) }
+                thread { actor(LockstepInvocationsTest::receive) }
+            }
+        }
+        withLockstepRunner(scenario, validationFunction = null) { runner ->
+            repeat(10) {
+                val result = runner.run()
+                check(result is CompletedInvocationResult)
+                assertEquals(1, runner.lastRunInvocationsCount)
+                assertEquals(1, (result.results.parallelResultsWithClock[1].single().result as ValueResult).value)
+            }
+        }
+    }
+
+    // The batch size grows with the observed invocation time, which is far below the timeout here.
+    private fun warmUpBatches(runner: ParallelThreadsRunner) {
+        repeat(10) {
+            check(runner.run() is CompletedInvocationResult)
+            if (runner.lastRunInvocationsCount >= 2) return
+        }
+        fail("The lockstep batch size has not grown")
+    }
+
+    private fun withLockstepRunner(scenario: ExecutionScenario, validationFunction: Actor?, block: (ParallelThreadsRunner) -> Unit) {
+        ParallelThreadsRunner(
+            strategy = mockStrategy(scenario), testClass = this::class.java, validationFunction = validationFunction,
+            stateRepresentationFunction = null, timeoutMs = DEFAULT_TIMEOUT_MS, useClocks = ALWAYS
+        ).use { runner ->
+            runner.runInLockstep = true
+            block(runner)
+        }
+    }
+
+    companion object {
+        private val createdInstances = AtomicInteger()
+
+        @Volatile
+        private var failingInstance = -1
+    }
+}
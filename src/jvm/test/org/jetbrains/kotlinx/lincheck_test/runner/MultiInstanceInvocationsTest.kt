@@ -0,0 +1,86 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.runner
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.CTestConfiguration.Companion.DEFAULT_TIMEOUT_MS
+import org.jetbrains.kotlinx.lincheck.runner.*
+import org.jetbrains.kotlinx.lincheck.runner.UseClocks.*
+import org.junit.*
+import org.junit.Assert.*
+import java.util.concurrent.atomic.*
+
+/**
+ * Checks that [ParallelThreadsRunner] executes each invocation on several fresh test instances
+ * in the multi-instance mode, and reports the results of the selected instance.
+ */
+class MultiInstanceInvocationsTest {
+    private val instanceId = createdInstances.incrementAndGet()
+
+    fun id() = instanceId
+
+    fun validate() = check(instanceId != failingInstance)
+
+    private val scenario = scenario {
+        initial { actor(MultiInstanceInvocationsTest::id) }
+        parallel {
+            thread { actor(MultiInstanceInvocationsTest::id) }
+            thread { actor(MultiInstanceInvocationsTest::id) }
+        }
+        post { actor(MultiInstanceInvocationsTest::id) }
+    }
+
+    @Test
+    fun testResultsOfEachInstanceAreSelected() = withMultiInstanceRunner(validationFunction = null) { runner ->
+        repeat(3) {
+            val firstInstance = createdInstances.get() + 1
+            val result = runner.run()
+            check(result is CompletedInvocationResult)
+            assertEquals(INSTANCES, runner.completedInstancesCount)
+            assertEquals(firstInstance + INSTANCES - 1, createdInstances.get())
+            for (k in 0 until INSTANCES) {
+                val results = (if (k == 0) result else runner.selectInstanceResults(k)).results
+                assertEquals("The results of instance $k are expected", instanceResults(firstInstance + k), results.allResults())
+            }
+        }
+    }
+
+    @Test
+    fun testValidationFailureReportsFailedInstance() = withMultiInstanceRunner(actor(MultiInstanceInvocationsTest::validate)) { runner ->
+        check(runner.run() is CompletedInvocationResult)
+        failingInstance = createdInstances.get() + 3
+        val result = runner.run()
+        check(result is ValidationFailureInvocationResult) { "ValidationFailureInvocationResult is expected, but $result is found" }
+        assertEquals(instanceResults(failingInstance), result.results.allResults())
+    }
+
+    private fun instanceResults(id: Int) = List(4) { ValueResult(id) }
+
+    private fun ExecutionResult.allResults() = initResults + parallelResultsWithClock.map { it.single().result } + postResults
+
+    private fun withMultiInstanceRunner(validationFunction: Actor?, block: (ParallelThreadsRunner) -> Unit) {
+        ParallelThreadsRunner(
+            strategy = mockStrategy(scenario), testClass = this::class.java, validationFunction = validationFunction,
+            stateRepresentationFunction = null, timeoutMs = DEFAULT_TIMEOUT_MS, useClocks = NEVER
+        ).use { runner ->
+            runner.instancesPerInvocation = INSTANCES
+            block(runner)
+        }
+    }
+
+    companion object {
+        private const val INSTANCES = 4
+
+        private val createdInstances = AtomicInteger()
+
+        @Volatile
+        private var failingInstance = -1
+    }
+}
@@ -114,4 +114,27 @@ public class TestThreadExecutionHelperTest {
             ExceptionResult.Companion.create(new NoSuchElementException())
         }, ex.results);
     }
-}
\ No newline at end of file
+
+    @Test
+    public void testExecutionClassReuse() throws Exception {
+        TestThreadExecution ex1 = TestThreadExecutionGenerator.create(runner, 0,
+            asList(
+                new Actor(Queue.class.getMethod("add", Object.class), asList(1)),
+                new Actor(Queue.class.getMethod("peek"), emptyList())
+            ), emptyList(), false);
+        TestThreadExecution ex2 = TestThreadExecutionGenerator.create(runner, 1,
+            asList(
+                new Actor(Queue.class.getMethod("add", Object.class), asList(2)),
+                new Actor(Queue.class.getMethod("peek"), emptyList())
+            ), emptyList(), false);
+        Assert.assertSame(ex1.getClass(), ex2.getClass());
+        ex1.testInstance = new ArrayDeque<>();
+        ex1.results = new Result[2];
+        ex1.run();
+        ex2.testInstance = new ArrayDeque<>();
+        ex2.results = new Result[2];
+        ex2.run();
+        Assert.assertArrayEquals(new Result[]{ new ValueResult(true), new ValueResult(1) }, ex1.results);
+        Assert.assertArrayEquals(new Result[]{ new ValueResult(true), new ValueResult(2) }, ex2.results);
+    }
+}
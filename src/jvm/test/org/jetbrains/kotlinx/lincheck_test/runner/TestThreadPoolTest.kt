@@ -0,0 +1,68 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.runner
+
+import org.jetbrains.kotlinx.lincheck.runner.*
+import org.junit.Assert.*
+import org.junit.*
+import sun.nio.ch.lincheck.TestThread
+import java.util.concurrent.*
+
+class TestThreadPoolTest {
+    // Unusual thread indices are used, so that the tests running in parallel do not interfere.
+
+    @Test
+    fun testThreadIsReused() {
+        val threadId = 1001
+        val first = runJob(threadId, reusable = true)
+        val second = runJob(threadId, reusable = true)
+        assertSame(first, second)
+        assertEquals(threadId, second.threadId)
+        assertEquals("Lincheck-TestThreadPoolTest-$threadId", second.name)
+    }
+
+    @Test
+    fun testThreadIsNotReusedAfterFailedJob() {
+        val threadId = 1002
+        val first = runJob(threadId, reusable = false)
+        first.join()
+        val second = runJob(threadId, reusable = true)
+        assertNotSame(first, second)
+    }
+
+    @Test
+    fun testConcurrentJobsUseDifferentThreads() {
+        val threadId = 1003
+        val started = CountDownLatch(2)
+        val finish = CountDownLatch(1)
+        val job = {
+            started.countDown()
+            finish.await()
+            true
+        }
+        val first = TestThreadPool.start("TestThreadPoolTest", threadId, job)
+        val second = TestThreadPool.start("TestThreadPoolTest", threadId, job)
+        started.await()
+        finish.countDown()
+        assertNotSame(first, second)
+    }
+
+    private fun runJob(threadId: Int, reusable: Boolean): TestThread {
+        val done = CountDownLatch(1)
+        val thread = TestThreadPool.start("TestThreadPoolTest", threadId) {
+            done.countDown()
+            reusable
+        }
+        done.await()
+        // Wait until the thread returns to the pool or terminates.
+        while (thread.isAlive && thread.state != Thread.State.TIMED_WAITING) Thread.yield()
+        return thread
+    }
+}
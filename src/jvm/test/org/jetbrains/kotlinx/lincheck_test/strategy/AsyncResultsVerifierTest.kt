@@ -0,0 +1,75 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.strategy
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.verifier.*
+import org.jetbrains.kotlinx.lincheck_test.verifier.*
+import org.junit.*
+import org.junit.Assert.*
+
+/**
+ * Checks that [AsyncResultsVerifier], which verifies the results in the pipelined stress mode,
+ * reports the earliest submitted incorrect results and verifies them in its own thread.
+ */
+class AsyncResultsVerifierTest {
+    private val scenario = results(0).first
+
+    @Test
+    fun testEarliestIncorrectResultsAreReported() {
+        val verifier = RecordingVerifier { it != 2 && it != 4 }
+        val asyncVerifier = AsyncResultsVerifier(verifier, scenario, queueCapacity = 2)
+        for (value in 1..5) asyncVerifier.submit(results(value).second)
+        assertEquals(results(2).second, asyncVerifier.awaitCompletion())
+        // The results submitted after the failure are skipped.
+        assertEquals(listOf(1, 2), verifier.verifiedValues)
+        assertEquals(2, asyncVerifier.verificationsCount)
+    }
+
+    @Test
+    fun testResultsAreVerifiedInWorkerThread() {
+        val verifier = RecordingVerifier { true }
+        val asyncVerifier = AsyncResultsVerifier(verifier, scenario)
+        for (value in 1..100) asyncVerifier.submit(results(value).second)
+        assertNull(asyncVerifier.awaitCompletion())
+        assertEquals((1..100).toList(), verifier.verifiedValues)
+        assertEquals(100, asyncVerifier.verificationsCount)
+        assertTrue(verifier.threads.none { it === Thread.currentThread() })
+    }
+
+    @Test(expected = IllegalStateException::class)
+    fun testVerifierExceptionIsRethrown() {
+        val asyncVerifier = AsyncResultsVerifier(RecordingVerifier { error("verifier failure") }, scenario)
+        asyncVerifier.submit(results(1).second)
+        asyncVerifier.awaitCompletion()
+    }
+
+    private fun results(value: Int) = scenarioWithResults {
+        parallel {
+            thread { operation(actor(AsyncResultsVerifierTest::operation), ValueResult(value)) }
+        }
+    }
+
+    fun operation() = 0
+
+    private class RecordingVerifier(private val isCorrect: (Int) -> Boolean) : Verifier {
+        val verifiedValues = mutableListOf<Int>()
+        val threads = mutableSetOf<Thread>()
+
+        override fun verifyResults(scenario: ExecutionScenario, results: ExecutionResult): Boolean {
+            threads += Thread.currentThread()
+            val value = (results.parallelResultsWithClock[0][0].result as ValueResult).value as Int
+            verifiedValues += value
+            return isCorrect(value)
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.strategy.stress
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.*
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import org.junit.Assert.*
+import org.junit.*
+import java.util.concurrent.*
+import java.util.concurrent.locks.*
+
+/**
+ * Checks that deadlocks and, when enabled, stalls are detected in the stress mode
+ * much faster than the invocation timeout expires.
+ */
+class ActiveHangDetectionTest {
+    private val lock1 = Object()
+    private val lock2 = Object()
+    private val barrier = CyclicBarrier(2)
+
+    @Operation
+    fun lock12() = synchronized(lock1) {
+        barrier.await()
+        synchronized(lock2) {}
+    }
+
+    @Operation
+    fun lock21() = synchronized(lock2) {
+        barrier.await()
+        synchronized(lock1) {}
+    }
+
+    @Operation
+    fun park() = LockSupport.park()
+
+    @Operation
+    fun awaitExternalThread(): Int {
+        val future = CompletableFuture<Int>()
+        Thread {
+            Thread.sleep(1_000)
+            future.complete(42)
+        }.start()
+        return future.get()
+    }
+
+    @Test(timeout = 30_000)
+    fun testDeadlock() = checkHangIsDetectedFast {
+        parallel {
+            thread { actor(ActiveHangDetectionTest::lock12) }
+            thread { actor(ActiveHangDetectionTest::lock21) }
+        }
+    }
+
+    @Test(timeout = 30_000)
+    fun testStall() = withStallTimeMs(500) {
+        checkHangIsDetectedFast {
+            parallel {
+                thread { actor(ActiveHangDetectionTest::park) }
+                thread { actor(ActiveHangDetectionTest::park) }
+            }
+        }
+    }
+
+    /**
+     * The stall detection is disabled by default, so waiting
+     * for a thread outside the test is not reported as a hang.
+     */
+    @Test(timeout = 30_000)
+    fun testWaitingForExternalThread() {
+        val failure = StressOptions()
+            .addCustomScenario {
+                parallel {
+                    thread { actor(ActiveHangDetectionTest::awaitExternalThread) }
+                    thread { actor(ActiveHangDetectionTest::awaitExternalThread) }
+                }
+            }
+            .iterations(0)
+            .invocationsPerIteration(2)
+            .checkImpl(this::class.java)
+        assertNull(failure)
+    }
+
+    private fun checkHangIsDetectedFast(scenario: DSLScenarioBuilder.() -> Unit) {
+        val startTime = System.currentTimeMillis()
+        val failure = StressOptions()
+            .addCustomScenario(scenario)
+            .iterations(0)
+            .invocationTimeout(60_000)
+            .minimizeFailedScenario(false)
+            .checkImpl(this::class.java)
+        assertTrue("TimeoutFailure is expected, but $failure is found", failure is TimeoutFailure)
+        assertTrue(System.currentTimeMillis() - startTime < 20_000)
+    }
+
+    private fun withStallTimeMs(stallTimeMs: Long, block: () -> Unit) {
+        System.setProperty(STALL_TIME_PROPERTY, stallTimeMs.toString())
+        try {
+            block()
+        } finally {
+            System.clearProperty(STALL_TIME_PROPERTY)
+        }
+    }
+}
+
+private const val STALL_TIME_PROPERTY = "lincheck.hangDetection.stallTimeMs"
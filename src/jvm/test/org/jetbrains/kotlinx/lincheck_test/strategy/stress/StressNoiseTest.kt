@@ -0,0 +1,52 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.strategy.stress
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import org.junit.*
+import org.junit.Assert.*
+
+/**
+ * Checks that the noise injected before the shared memory accesses exposes a race
+ * whose window between a read and the following write is only a few instructions wide.
+ */
+class StressNoiseTest {
+    private var taken = false
+
+    @Operation
+    fun take(): Boolean {
+        if (taken) return false
+        taken = true
+        return true
+    }
+
+    @Test
+    fun testNoiseExposesRace() {
+        val failure = StressOptions()
+            .addCustomScenario {
+                parallel {
+                    thread { actor(::take) }
+                    thread { actor(::take) }
+                }
+            }
+            .iterations(0)
+            .invocationsPerIteration(INVOCATIONS)
+            .noiseProbability(1.0)
+            .minimizeFailedScenario(false)
+            .checkImpl(this::class.java)
+        assertTrue("IncorrectResultsFailure is expected within $INVOCATIONS invocations, but $failure is found",
+            failure is IncorrectResultsFailure)
+    }
+}
+
+private const val INVOCATIONS = 1_000
@@ -0,0 +1,55 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.util
+
+import org.jetbrains.kotlinx.lincheck.util.*
+import org.junit.Assert.*
+import org.junit.*
+import java.util.concurrent.atomic.*
+
+class SpinnerTest {
+
+    @Test
+    fun testSpinBoundAdaptsToShortWaits() {
+        val spinner = Spinner()
+        Assume.assumeTrue(spinner.shouldSpin)
+        val initialBound = spinner.spinCyclesBound
+        repeat(100) {
+            var counter = 0
+            assertTrue(spinner.spinWaitBoundedUntil { ++counter > 10 })
+        }
+        assertTrue(spinner.spinCyclesBound < initialBound)
+        assertEquals(0, spinner.spinFailureCount)
+        assertTrue(spinner.spinCount > 0)
+    }
+
+    @Test
+    fun testBackoffAfterFailedSpinning() {
+        val spinner = Spinner()
+        val flag = AtomicBoolean(false)
+        val thread = Thread {
+            Thread.sleep(500)
+            flag.set(true)
+        }.also { it.start() }
+        spinner.spinWaitUntil { flag.get() }
+        thread.join()
+        assertEquals(1, spinner.spinFailureCount)
+        assertTrue(spinner.yieldCount > 0)
+        assertTrue(spinner.parkCount > 0)
+    }
+
+    @Test
+    fun testDoesNotSpinWithoutEnoughProcessors() {
+        val spinner = Spinner(nThreads = Int.MAX_VALUE)
+        assertFalse(spinner.shouldSpin)
+        assertFalse(spinner.spinWaitBoundedUntil { false })
+        assertEquals(0, spinner.spinCount)
+    }
+}
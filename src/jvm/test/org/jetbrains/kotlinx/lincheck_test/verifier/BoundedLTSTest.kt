@@ -0,0 +1,67 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.verifier
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck.verifier.*
+import org.jetbrains.kotlinx.lincheck.verifier.linearizability.*
+import org.jetbrains.kotlinx.lincheck_test.*
+import java.util.concurrent.*
+
+/**
+ * Checks that verification stays correct when LTS states are constantly evicted
+ * and the interned actor ids are constantly re-assigned.
+ */
+class BoundedLTSTest : AbstractLincheckTest() {
+    private val q = ConcurrentLinkedDeque<Int>()
+
+    @Operation
+    fun addLast(value: Int) = q.addLast(value)
+
+    @Operation
+    fun pollFirst() = q.pollFirst()
+
+    @Operation
+    fun pollLast() = q.pollLast()
+
+    override fun <O : Options<O, *>> O.customize() {
+        verifier(TinyLTSLinearizabilityVerifier::class.java)
+    }
+
+    override fun extractState() = q.toList()
+}
+
+class IncorrectBoundedLTSTest : AbstractLincheckTest(IncorrectResultsFailure::class) {
+    private val q = ConcurrentLinkedDeque<Int>()
+
+    @Operation
+    fun addLast(value: Int) = q.addLast(value)
+
+    @Operation
+    fun pollFirst() = q.pollLast()
+
+    @Operation
+    fun pollLast() = q.pollFirst()
+
+    override fun <O : Options<O, *>> O.customize() {
+        sequentialSpecification(CopyableDeque::class.java)
+        verifier(TinyLTSLinearizabilityVerifier::class.java)
+    }
+}
+
+class TinyLTSLinearizabilityVerifier(sequentialSpecification: Class<*>) : AbstractLTSVerifier(sequentialSpecification) {
+    override val lts: LTS = LTS(sequentialSpecification = sequentialSpecification, maxStates = 3, maxInternedActors = 2)
+
+    override fun createInitialContext(scenario: ExecutionScenario, results: ExecutionResult) =
+        LinearizabilityContext(scenario, results, lts.initialState)
+}
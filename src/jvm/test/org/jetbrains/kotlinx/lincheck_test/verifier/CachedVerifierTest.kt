@@ -0,0 +1,83 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.verifier
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.verifier.*
+import org.junit.Assert.*
+import org.junit.*
+
+/**
+ * Checks that [CachedVerifier] looks up the verified results by their fingerprints.
+ */
+class CachedVerifierTest {
+    private val scenario = scenarioWithResults { build(ValueResult(1), ValueResult(2)) }.first
+
+    @Test
+    fun testEqualResultsAreVerifiedOnce() {
+        val verifier = CountingVerifier(correct = true)
+        repeat(3) {
+            assertTrue(verifier.verifyResults(scenario, results(ValueResult(1), ValueResult(2))))
+        }
+        assertEquals(1, verifier.invocations)
+        assertTrue(verifier.isVerified(scenario, results(ValueResult(1), ValueResult(2)).fingerprint) { true })
+        assertTrue(verifier.verifyResults(scenario, results(ValueResult(2), ValueResult(1))))
+        assertEquals(2, verifier.invocations)
+    }
+
+    @Test
+    fun testIncorrectResultsAreNotCached() {
+        val verifier = CountingVerifier(correct = false)
+        repeat(3) {
+            assertFalse(verifier.verifyResults(scenario, results(ValueResult(1), ValueResult(2))))
+        }
+        assertEquals(3, verifier.invocations)
+    }
+
+    @Test
+    fun testFingerprintMatchIsConfirmed() {
+        val verifier = CountingVerifier(correct = true)
+        val results = results(ValueResult(1), ValueResult(2))
+        verifier.verifyResults(scenario, results)
+        assertFalse(verifier.isVerified(scenario, results.fingerprint) { false })
+    }
+
+    @Test
+    fun testFingerprintDependsOnClocks() {
+        val results = results(ValueResult(1), ValueResult(2))
+        assertEquals(results.fingerprint, results(ValueResult(1), ValueResult(2)).fingerprint)
+        val parallelResultsWithClock = results.parallelResultsWithClock.mapIndexed { t, threadResults ->
+            threadResults.map { ResultWithClock(it.result, HBClock(IntArray(2) { i -> if (i != t) 1 else 0 })) }
+        }
+        val resultsWithClocks = ExecutionResult(results.initResults, parallelResultsWithClock, results.postResults)
+        assertNotEquals(results.fingerprint, resultsWithClocks.fingerprint)
+    }
+
+    private fun results(r1: Result, r2: Result) = scenarioWithResults { build(r1, r2) }.second
+
+    private fun ExecutionBuilder.build(r1: Result, r2: Result) {
+        parallel {
+            thread { operation(actor(CachedVerifierTest::operation), r1) }
+            thread { operation(actor(CachedVerifierTest::operation), r2) }
+        }
+    }
+
+    fun operation() = 0
+
+    private class CountingVerifier(private val correct: Boolean) : CachedVerifier() {
+        var invocations = 0
+
+        override fun verifyResultsImpl(scenario: ExecutionScenario, results: ExecutionResult): Boolean {
+            invocations++
+            return correct
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.verifier
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.strategy.*
+import org.jetbrains.kotlinx.lincheck_test.*
+import java.util.concurrent.*
+
+/**
+ * Checks that LTS transitions are computed correctly when
+ * the sequential specification instances are copied instead of being replayed.
+ */
+class CopyableSequentialSpecificationTest : AbstractLincheckTest() {
+    private val q = ConcurrentLinkedDeque<Int>()
+
+    @Operation
+    fun addLast(value: Int) = q.addLast(value)
+
+    @Operation
+    fun pollFirst() = q.pollFirst()
+
+    @Operation
+    fun pollLast() = q.pollLast()
+
+    override fun <O : Options<O, *>> O.customize() {
+        sequentialSpecification(CopyableDeque::class.java)
+    }
+}
+
+class IncorrectCopyableSequentialSpecificationTest : AbstractLincheckTest(IncorrectResultsFailure::class) {
+    private val q = ConcurrentLinkedDeque<Int>()
+
+    @Operation
+    fun addLast(value: Int) = q.addLast(value)
+
+    @Operation
+    fun pollFirst() = q.pollLast()
+
+    @Operation
+    fun pollLast() = q.pollFirst()
+
+    override fun <O : Options<O, *>> O.customize() {
+        sequentialSpecification(CopyableDeque::class.java)
+    }
+}
+
+class CopyableDeque {
+    private val q = ArrayDeque<Int>()
+
+    fun addLast(value: Int) = q.addLast(value)
+    fun pollFirst() = q.removeFirstOrNull()
+    fun pollLast() = q.removeLastOrNull()
+
+    fun copy() = CopyableDeque().also { it.q.addAll(q) }
+
+    override fun equals(other: Any?) = other is CopyableDeque && q == other.q
+    override fun hashCode() = q.hashCode()
+}
@@ -0,0 +1,62 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.verifier
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.StateFingerprint
+import org.jetbrains.kotlinx.lincheck.transformation.*
+import org.jetbrains.kotlinx.lincheck.verifier.*
+import org.junit.*
+import org.junit.Assert.*
+
+/**
+ * Checks that [LTS] merges equivalent states of sequential specifications
+ * which do not define `equals` and `hashCode`.
+ */
+class StateEquivalenceTest {
+    @Test
+    fun testStructuralEquivalence() = withLincheckJavaAgent(InstrumentationMode.STRESS) {
+        val lts = LTS(StructuralCounter::class.java)
+        val afterInc = lts.initialState.next(actor(StructuralCounter::inc), ValueResult(1), NO_TICKET)!!.nextState
+        val afterDec = afterInc.next(actor(StructuralCounter::dec), ValueResult(0), NO_TICKET)!!.nextState
+        assertNotSame(lts.initialState, afterInc)
+        assertSame(lts.initialState, afterDec)
+    }
+
+    @Test
+    fun testStateFingerprint() = withLincheckJavaAgent(InstrumentationMode.STRESS) {
+        val lts = LTS(FingerprintedCounter::class.java)
+        val afterInc = lts.initialState.next(actor(FingerprintedCounter::inc), ValueResult(1), NO_TICKET)!!.nextState
+        val afterDec = afterInc.next(actor(FingerprintedCounter::dec), ValueResult(0), NO_TICKET)!!.nextState
+        // `operations` field differs, but the fingerprint considers only the counter value
+        assertSame(lts.initialState, afterDec)
+    }
+}
+
+class StructuralCounter {
+    private var value = 0
+    private val history = Node(null)
+
+    fun inc(): Int = ++value
+    fun dec(): Int = --value
+
+    private class Node(val next: Node?)
+}
+
+class FingerprintedCounter {
+    private var value = 0
+    private var operations = 0
+
+    fun inc(): Int { operations++; return ++value }
+    fun dec(): Int { operations++; return --value }
+
+    @StateFingerprint
+    fun fingerprint(): Any = value
+}
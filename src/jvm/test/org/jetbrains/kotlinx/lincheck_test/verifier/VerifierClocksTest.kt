@@ -0,0 +1,90 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package org.jetbrains.kotlinx.lincheck_test.verifier
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.annotations.Operation
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.strategy.managed.modelchecking.*
+import org.jetbrains.kotlinx.lincheck.strategy.stress.*
+import org.jetbrains.kotlinx.lincheck.verifier.*
+import org.jetbrains.kotlinx.lincheck.verifier.linearizability.*
+import org.junit.*
+import org.junit.Assert.*
+import java.util.*
+import java.util.concurrent.atomic.*
+
+/**
+ * Checks that the happens-before clocks are recorded only for the verifiers that [use them][Verifier.usesClocks].
+ */
+class VerifierClocksTest {
+    private val counter = AtomicInteger()
+
+    @Operation
+    fun incAndGet() = counter.incrementAndGet()
+
+    @Operation
+    fun get() = counter.get()
+
+    @Test
+    fun testEpsilonVerifierInStressMode() =
+        checkClocks(StressOptions(), EpsilonRecordingVerifier::class.java, expectClocks = false)
+
+    @Test
+    fun testEpsilonVerifierInModelCheckingMode() =
+        checkClocks(ModelCheckingOptions(), EpsilonRecordingVerifier::class.java, expectClocks = false)
+
+    @Test
+    fun testSerializabilityVerifierInStressMode() =
+        checkClocks(StressOptions(), SerializabilityRecordingVerifier::class.java, expectClocks = false)
+
+    @Test
+    fun testLinearizabilityVerifierInStressMode() =
+        checkClocks(StressOptions(), LinearizabilityRecordingVerifier::class.java, expectClocks = true)
+
+    private fun <O : Options<O, *>> checkClocks(options: O, verifierClass: Class<out Verifier>, expectClocks: Boolean) {
+        recordedResults.clear()
+        options
+            .iterations(5)
+            .invocationsPerIteration(50)
+            .threads(2)
+            .actorsPerThread(2)
+            .verifier(verifierClass)
+            .check(this::class.java)
+        assertTrue(recordedResults.isNotEmpty())
+        val hasClocks = recordedResults.any { result ->
+            result.parallelResultsWithClock.any { threadResults -> threadResults.any { !it.clockOnStart.empty } }
+        }
+        assertEquals(expectClocks, hasClocks)
+    }
+}
+
+private val recordedResults: MutableList<ExecutionResult> = Collections.synchronizedList(ArrayList())
+
+/**
+ * Records the results passed to the specified [verifier].
+ */
+abstract class RecordingVerifier(private val verifier: Verifier) : Verifier {
+    override fun verifyResults(scenario: ExecutionScenario, results: ExecutionResult): Boolean {
+        recordedResults += results
+        return verifier.verifyResults(scenario, results)
+    }
+
+    override fun usesClocks() = verifier.usesClocks()
+}
+
+class EpsilonRecordingVerifier(sequentialSpecification: Class<*>) :
+    RecordingVerifier(EpsilonVerifier(sequentialSpecification))
+
+class SerializabilityRecordingVerifier(sequentialSpecification: Class<*>) :
+    RecordingVerifier(SerializabilityVerifier(sequentialSpecification))
+
+class LinearizabilityRecordingVerifier(sequentialSpecification: Class<*>) :
+    RecordingVerifier(LinearizabilityVerifier(sequentialSpecification))
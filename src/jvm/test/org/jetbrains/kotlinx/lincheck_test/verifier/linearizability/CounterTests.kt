@@ -12,7 +12,7 @@ package org.jetbrains.kotlinx.lincheck_test.verifier.linearizability
 import org.jetbrains.kotlinx.lincheck.annotations.Operation
 import org.jetbrains.kotlinx.lincheck.strategy.*
 import org.jetbrains.kotlinx.lincheck_test.AbstractLincheckTest
-import java.util.concurrent.atomic.*
+import org.jetbrains.kotlinx.lincheck_corpus.*
 import kotlin.reflect.KClass
 
 abstract class AbstractCounterTest(
@@ -29,40 +29,3 @@ class CounterCorrectTest : AbstractCounterTest(CounterCorrect())
 class CounterWrong0Test : AbstractCounterTest(CounterWrong0(), IncorrectResultsFailure::class)
 class CounterWrong1Test : AbstractCounterTest(CounterWrong1(), IncorrectResultsFailure::class)
 class CounterWrong2Test : AbstractCounterTest(CounterWrong2(), IncorrectResultsFailure::class)
-
-interface Counter {
-    fun incAndGet(): Int
-    fun get(): Int
-}
-
-private class CounterWrong0 : Counter {
-    private var c: Int = 0
-
-    override fun incAndGet(): Int = ++c
-    override fun get(): Int = c
-}
-
-private class CounterWrong1 : Counter {
-    private var c: Int = 0
-
-    override fun incAndGet(): Int {
-        c++
-        return c
-    }
-    override fun get(): Int = c
-}
-
-private class CounterWrong2 : Counter {
-    @Volatile
-    private var c: Int = 0
-
-    override fun incAndGet(): Int = ++c
-    override fun get(): Int = c
-}
-
-private class CounterCorrect : Counter {
-    private val c = AtomicInteger()
-
-    override fun incAndGet(): Int = c.incrementAndGet()
-    override fun get(): Int = c.get()
-}
@@ -0,0 +1,78 @@
+/*
+ * Lincheck
+ *
+ * Copyright (C) 2019 - 2023 JetBrains s.r.o.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+package org.jetbrains.kotlinx.lincheck_test.verifier.quiescent
+
+import org.jetbrains.kotlinx.lincheck.*
+import org.jetbrains.kotlinx.lincheck.execution.*
+import org.jetbrains.kotlinx.lincheck.transformation.*
+import org.jetbrains.kotlinx.lincheck.verifier.quiescent.*
+import org.junit.*
+import org.junit.Assert.*
+
+/**
+ * Checks that [QuiescentConsistencyVerifier] reorders [QuiescentConsistent]
+ * operations only inside the segments delimited by quiescent points.
+ */
+class QuiescentPointsTest {
+    private var c = 0
+
+    @QuiescentConsistent
+    fun incAndGet(): Int = ++c
+
+    private val inc = actor(QuiescentPointsTest::incAndGet)
+
+    @Test
+    fun testReorderingInsideSegment() = withLincheckJavaAgent(InstrumentationMode.STRESS) {
+        // t0: [incAndGet(): 3, incAndGet(): 1] || t1: [incAndGet(): 2], all concurrent
+        val results = results(
+            listOf(ValueResult(3) to intArrayOf(0, 0), ValueResult(1) to intArrayOf(1, 0)),
+            listOf(ValueResult(2) to intArrayOf(0, 0))
+        )
+        assertTrue(verifier().verifyResults(scenario(), results))
+    }
+
+    @Test
+    fun testQuiescentPointOrdersOperations() = withLincheckJavaAgent(InstrumentationMode.STRESS) {
+        // t1 starts its operation only after both operations in t0 complete
+        val results = results(
+            listOf(ValueResult(1) to intArrayOf(0, 0), ValueResult(3) to intArrayOf(1, 0)),
+            listOf(ValueResult(2) to intArrayOf(2, 0))
+        )
+        assertFalse(verifier().verifyResults(scenario(), results))
+    }
+
+    @Test
+    fun testInitPart() = withLincheckJavaAgent(InstrumentationMode.STRESS) {
+        // init: [incAndGet(): 1]; t0: [incAndGet(): 3] || t1: [incAndGet(): 2, incAndGet(): 4], all concurrent
+        val scenario = ExecutionScenario(listOf(inc), listOf(listOf(inc), listOf(inc, inc)), emptyList(), null)
+        val results = ExecutionResult(
+            listOf(ValueResult(1)),
+            listOf(
+                listOf(ResultWithClock(ValueResult(3), HBClock(intArrayOf(0, 0)))),
+                listOf(ResultWithClock(ValueResult(2), HBClock(intArrayOf(0, 0))), ResultWithClock(ValueResult(4), HBClock(intArrayOf(0, 1))))
+            ),
+            emptyList()
+        )
+        assertTrue(verifier().verifyResults(scenario, results))
+        val incorrectResults = results.copy(initResults = listOf(ValueResult(2)))
+        assertFalse(verifier().verifyResults(scenario, incorrectResults))
+    }
+
+    private fun verifier() = QuiescentConsistencyVerifier(QuiescentPointsTest::class.java)
+
+    private fun scenario() = ExecutionScenario(emptyList(), listOf(listOf(inc, inc), listOf(inc)), emptyList(), null)
+
+    private fun results(vararg threads: List<Pair<Result, IntArray>>) = ExecutionResult(
+        emptyList(),
+        threads.map { thread -> thread.map { (result, clock) -> ResultWithClock(result, HBClock(clock)) } },
+        emptyList()
+    )
+}